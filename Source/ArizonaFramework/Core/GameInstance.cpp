@@ -10,10 +10,12 @@
 #include "PlayerController.h"
 #include "PlayerState.h"
 #include "PlayerUI.h"
+#include "ArizonaFramework/Networking/ReplicationHierarchy.h"
 #include "ArizonaFramework/Utilities/Utilities.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/HashFunctions.h"
 #include "Engine/Core/Config/GameSettings.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
@@ -23,6 +25,7 @@
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Networking/NetworkClient.h"
 #include "Engine/Networking/NetworkManager.h"
+#include "Engine/Networking/NetworkSettings.h"
 #include "Engine/Networking/NetworkReplicator.h"
 #include "Engine/Networking/NetworkRpc.h"
 #include "Engine/Networking/NetworkReplicationHierarchy.h"
@@ -35,21 +38,190 @@
 #include "Engine/Scripting/ManagedCLR/MClass.h"
 #include "Engine/Scripting/Plugins/PluginManager.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 
 namespace
 {
+    // Scene system filters registered from code.
+    Dictionary<ScriptingTypeHandle, SceneSystemFilter> SceneSystemFiltersOverrides;
+
+    // Indices of the game system types (non-abstract) in the loaded binary modules. Collected once per module to skip scanning all types on every game start.
+    Dictionary<BinaryModule*, Array<int32>> SystemTypesCache;
+#if USE_EDITOR
+    bool SystemTypesCacheBound = false;
+#endif
+
+    void OnScriptsReloading()
+    {
+        SystemTypesCache.Clear();
+
+        // Filters can reference types and predicates from the reloaded code
+        SceneSystemFiltersOverrides.Clear();
+    }
+
+    const Array<int32>& GetSystemTypes(BinaryModule* module)
+    {
+        if (const Array<int32>* types = SystemTypesCache.TryGet(module))
+            return *types;
+        PROFILE_CPU();
+#if USE_EDITOR
+        if (!SystemTypesCacheBound)
+        {
+            // Modules get reloaded on scripts hot-reload in Editor
+            SystemTypesCacheBound = true;
+            Scripting::ScriptsReloading.Bind<&OnScriptsReloading>();
+        }
+#endif
+        Array<int32> types;
+        for (int32 i = 0; i < module->Types.Count(); i++)
+        {
+            const ScriptingType& type = module->Types[i];
+            if (type.Type != ScriptingTypes::Script || !ScriptingTypeHandle(module, i).IsSubclassOf(GameSystem::TypeInitializer))
+                continue;
+
+            // Skip abstract types
+            if (type.ManagedClass && type.ManagedClass->IsAbstract())
+                continue;
+
+            types.Add(i);
+        }
+        return SystemTypesCache[module] = MoveTemp(types);
+    }
+
+    int32 GetTickPhaseIndex(GameSystemTickPhases phase)
+    {
+        switch (phase)
+        {
+        case GameSystemTickPhases::PreInput:
+            return 0;
+        case GameSystemTickPhases::Update:
+            return 1;
+        case GameSystemTickPhases::LateUpdate:
+            return 2;
+        case GameSystemTickPhases::PreNetwork:
+            return 3;
+        default:
+            return -1;
+        }
+    }
+
+    bool TickAccessOverlaps(const Array<ScriptingTypeHandle>& a, const Array<ScriptingTypeHandle>& b)
+    {
+        for (const ScriptingTypeHandle& e : a)
+        {
+            for (const ScriptingTypeHandle& f : b)
+            {
+                if (e == f || e.IsSubclassOf(f) || f.IsSubclassOf(e))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    bool TickAccessConflicts(GameSystem* a, GameSystem* b)
+    {
+        // Every system writes to its own data
+        Array<ScriptingTypeHandle, InlinedAllocation<8>> writesA, writesB;
+        writesA.Add(a->TickWrites.Get(), a->TickWrites.Count());
+        writesA.Add(a->GetTypeHandle());
+        writesB.Add(b->TickWrites.Get(), b->TickWrites.Count());
+        writesB.Add(b->GetTypeHandle());
+        return TickAccessOverlaps(writesA, writesB) ||
+                TickAccessOverlaps(writesA, b->TickReads) ||
+                TickAccessOverlaps(a->TickReads, writesB);
+    }
+
     template<typename T>
-    void DeleteScript(T*& obj)
+    void ReleaseScript(GameInstance* instance, T*& obj)
     {
         if (obj)
         {
             if (obj->GetActor())
-                obj->GetActor()->DeleteObject();
+                instance->ReleasePooledActor(obj->GetActor());
             else
                 obj->DeleteObject();
             obj = nullptr;
         }
     }
+
+    uint32 GetTickAccessHash(const Array<GameSystem*>& systems)
+    {
+        uint32 hash = systems.Count();
+        for (const GameSystem* system : systems)
+        {
+            CombineHash(hash, (uint32)system->TickPhases);
+            CombineHash(hash, system->TickThreadSafe ? 1 : 0);
+            CombineHash(hash, system->TickReads.Count());
+            for (const ScriptingTypeHandle& e : system->TickReads)
+                CombineHash(hash, GetHash(e));
+            CombineHash(hash, system->TickWrites.Count());
+            for (const ScriptingTypeHandle& e : system->TickWrites)
+                CombineHash(hash, GetHash(e));
+        }
+        return hash;
+    }
+
+    template<typename T>
+    void GetInitializeWaves(const Array<T*>& systems, Array<int32>& systemWaves, bool sequentialMainThread)
+    {
+        systemWaves.Resize(systems.Count());
+        systemWaves.SetAll(0);
+        bool changed = true;
+        for (int32 pass = 0; changed && pass <= systems.Count(); pass++)
+        {
+            changed = false;
+            for (int32 i = 0; i < systems.Count(); i++)
+            {
+                for (const ScriptingTypeHandle& dependency : systems[i]->InitializeDependencies)
+                {
+                    for (int32 j = 0; j < systems.Count(); j++)
+                    {
+                        if (j != i && systems[j]->Is(dependency) && systemWaves[i] <= systemWaves[j])
+                        {
+                            systemWaves[i] = systemWaves[j] + 1;
+                            changed = true;
+                        }
+                    }
+                }
+                if (sequentialMainThread && !systems[i]->InitializeThreadSafe)
+                {
+                    // Systems that don't opt in see all the previous systems initialized (as with sequential initialization)
+                    for (int32 j = 0; j < i; j++)
+                    {
+                        const int32 minWave = systemWaves[j] + (systems[j]->InitializeThreadSafe ? 1 : 0);
+                        if (systemWaves[i] < minWave)
+                        {
+                            systemWaves[i] = minWave;
+                            changed = true;
+                        }
+                    }
+                }
+            }
+        }
+        if (changed)
+            LOG(Warning, "Cyclic dependencies between game systems initialization.");
+        for (int32 i = 0; i < systems.Count(); i++)
+            systemWaves[i] = Math::Min(systemWaves[i], systems.Count() - 1);
+    }
+
+    template<typename T>
+    void RemoveFirstItems(Array<T>& array, int32 count)
+    {
+        const int32 remaining = array.Count() - count;
+        for (int32 i = 0; i < remaining; i++)
+            array[i] = array[i + count];
+        array.Resize(remaining);
+    }
+
+    // True if the current thread initializes scene system (see GameInstance::InitializeSceneSystemJob).
+    thread_local bool IsSceneSystemJob = false;
+
+    Actor* SpawnPlayerPrefab(Prefab* prefab)
+    {
+        if (auto* instance = GameInstance::GetInstance())
+            return instance->SpawnPooledPrefab(prefab);
+        return PrefabManager::SpawnPrefab(prefab, nullptr, nullptr);
+    }
 }
 
 GameSystem::GameSystem(const SpawnParams& params)
@@ -80,7 +252,7 @@ Actor* GameMode::CreatePlayerPawn(PlayerState* playerState)
     const auto& settings = *GameInstanceSettings::Get();
     if (Prefab* playerPawnPrefab = settings.PlayerPawnPrefab.Get())
     {
-        return PrefabManager::SpawnPrefab(playerPawnPrefab, nullptr, nullptr);
+        return SpawnPlayerPrefab(playerPawnPrefab);
     }
     return nullptr;
 }
@@ -90,7 +262,7 @@ Actor* GameMode::CreatePlayerController(PlayerState* playerState)
     const auto& settings = *GameInstanceSettings::Get();
     if (Prefab* playerControllerPrefab = settings.PlayerControllerPrefab.Get())
     {
-        return PrefabManager::SpawnPrefab(playerControllerPrefab, nullptr, nullptr);
+        return SpawnPlayerPrefab(playerControllerPrefab);
     }
     return nullptr;
 }
@@ -99,6 +271,12 @@ void GameMode::OnPlayerJoined(PlayerState* playerState)
 {
 }
 
+void GameMode::OnPlayersJoined(const Array<PlayerState*>& playerStates)
+{
+    for (PlayerState* playerState : playerStates)
+        OnPlayerJoined(playerState);
+}
+
 void GameMode::OnPlayerLeft(PlayerState* playerState)
 {
 }
@@ -114,22 +292,96 @@ GameState::GameState(const SpawnParams& params)
 
 PlayerState* GameState::GetPlayerStateByNetworkClientId(uint32 networkClientId) const
 {
-    for (PlayerState* playerState : PlayerStates)
+    const auto* players = _playersByClientId.TryGet(networkClientId);
+    return players ? (*players)[0] : nullptr;
+}
+
+PlayerState* GameState::GetPlayerStateByPlayerId(uint32 playerId) const
+{
+    PlayerState* result = nullptr;
+    _playersById.TryGet(playerId, result);
+    return result;
+}
+
+Array<PlayerState*, InlinedAllocation<8>> GameState::GetPlayerStatesByNetworkClientId(uint32 networkClientId) const
+{
+    Array<PlayerState*, InlinedAllocation<8>> result;
+    if (const auto* players = _playersByClientId.TryGet(networkClientId))
+        result.Add(players->Get(), players->Count());
+    return result;
+}
+
+void GameState::AddPlayerState(PlayerState* playerState)
+{
+    PlayerStates.Add(playerState);
+    AddToIndex(playerState);
+}
+
+void GameState::RemovePlayerState(PlayerState* playerState)
+{
+    for (int32 i = 0; i < PlayerStates.Count(); i++)
     {
-        if (playerState && playerState->NetworkClientId == networkClientId)
-            return playerState;
+        if (PlayerStates[i] == playerState)
+        {
+            PlayerStates.RemoveAtKeepOrder(i);
+            break;
+        }
     }
-    return nullptr;
+    RemoveFromIndex(playerState);
 }
 
-PlayerState* GameState::GetPlayerStateByPlayerId(uint32 playerId) const
+void GameState::UpdatePlayerStateIndex(PlayerState* playerState)
 {
-    for (PlayerState* playerState : PlayerStates)
+    // Player identifiers can arrive after the Game State list got replicated (or the other way around)
+    bool isListed = false;
+    for (PlayerState* e : PlayerStates)
     {
-        if (playerState && playerState->PlayerId == playerId)
-            return playerState;
+        if (e == playerState)
+        {
+            isListed = true;
+            break;
+        }
     }
-    return nullptr;
+    RemoveFromIndex(playerState);
+    if (isListed)
+        AddToIndex(playerState);
+}
+
+void GameState::AddToIndex(PlayerState* playerState)
+{
+    if (!playerState)
+        return;
+    RemoveFromIndex(playerState);
+    playerState->_indexedPlayerId = playerState->PlayerId;
+    playerState->_indexedNetworkClientId = playerState->NetworkClientId;
+    if (playerState->PlayerId != MAX_uint32)
+        _playersById[playerState->PlayerId] = playerState;
+    if (playerState->NetworkClientId != MAX_uint32)
+    {
+        // Keep local coop players sorted by PlayerId so the first one is the one that joined first
+        auto& players = _playersByClientId[playerState->NetworkClientId];
+        int32 index = 0;
+        while (index < players.Count() && players[index]->PlayerId < playerState->PlayerId)
+            index++;
+        players.Insert(index, playerState);
+    }
+}
+
+void GameState::RemoveFromIndex(PlayerState* playerState)
+{
+    if (!playerState)
+        return;
+    PlayerState* indexed;
+    if (_playersById.TryGet(playerState->_indexedPlayerId, indexed) && indexed == playerState)
+        _playersById.Remove(playerState->_indexedPlayerId);
+    if (auto* players = _playersByClientId.TryGet(playerState->_indexedNetworkClientId))
+    {
+        players->Remove(playerState);
+        if (players->IsEmpty())
+            _playersByClientId.Remove(playerState->_indexedNetworkClientId);
+    }
+    playerState->_indexedPlayerId = MAX_uint32;
+    playerState->_indexedNetworkClientId = MAX_uint32;
 }
 
 PlayerState::PlayerState(const SpawnParams& params)
@@ -137,6 +389,56 @@ PlayerState::PlayerState(const SpawnParams& params)
 {
 }
 
+void PlayerState::OnDeleteObject()
+{
+    // Unlink from lookup index
+    if (_indexedPlayerId != MAX_uint32 || _indexedNetworkClientId != MAX_uint32)
+    {
+        const auto* instance = GameInstance::GetInstance();
+        if (GameState* gameState = instance ? instance->GetGameState() : nullptr)
+            gameState->RemoveFromIndex(this);
+    }
+
+    ScriptingObject::OnDeleteObject();
+}
+
+void PlayerState::OnNetworkDeserialize()
+{
+    auto* instance = GameInstance::GetInstance();
+    if (!instance)
+        return;
+
+    // Update lookup index when player identifiers got replicated
+    if (_indexedPlayerId != PlayerId || _indexedNetworkClientId != NetworkClientId)
+    {
+        if (GameState* gameState = instance->GetGameState())
+            gameState->UpdatePlayerStateIndex(this);
+    }
+
+    // Replicated pawn or controller could complete the player spawn
+    instance->UpdatePlayerSpawn(PlayerId);
+}
+
+void PlayerState::OnNetworkSpawn()
+{
+    // Players list is not replicated, instead each client adds the player when its state gets spawned
+    auto* instance = GameInstance::GetInstance();
+    GameState* gameState = instance ? instance->GetGameState() : nullptr;
+    if (!gameState || gameState->PlayerStates.Contains(this))
+        return;
+    gameState->AddPlayerState(this);
+
+    // Players waiting for their state can be spawned now
+    instance->UpdatePlayerSpawns(GameInstance::SpawnState);
+}
+
+void PlayerState::OnNetworkDespawn()
+{
+    const auto* instance = GameInstance::GetInstance();
+    if (GameState* gameState = instance ? instance->GetGameState() : nullptr)
+        gameState->RemovePlayerState(this);
+}
+
 PlayerPawn::PlayerPawn(const SpawnParams& params)
     : Script(params)
 {
@@ -158,29 +460,43 @@ void PlayerPawn::SetPlayerId(uint32 value)
 
     // Register for player spawn event
     if (auto* instance = GameInstance::GetInstance())
-        instance->_playersToSpawn.AddUnique(value);
+        instance->QueuePlayerSpawn(value);
 }
 
 void PlayerPawn::OnStart()
 {
     // Automatic spawn in the network for replication
+    SpawnNetwork();
+}
+
+void PlayerPawn::SpawnNetwork()
+{
+    if (_networkSpawned)
+        return;
+    _networkSpawned = true;
     NetworkReplicator::SpawnObject(this);
 }
 
 void PlayerPawn::OnDestroy()
+{
+    Despawn();
+}
+
+void PlayerPawn::Despawn()
 {
     // Invoke player despawn event
     if (_spawned)
     {
         if (auto* instance = GameInstance::GetInstance())
         {
-            instance->_playersToSpawn.Remove(_playerId);
+            instance->CancelPlayerSpawn(_playerId);
             instance->PlayerDespawned(this);
             if (auto* gameState = instance->GetGameState())
             {
                 if (auto* playerState = gameState->GetPlayerStateByPlayerId(_playerId))
                 {
                     playerState->PlayerPawn = nullptr;
+                    NetworkReplicator::DirtyObject(playerState);
                 }
             }
         }
@@ -209,11 +525,18 @@ Actor* PlayerController::CreatePlayerUI(PlayerState* playerState)
     const auto& settings = *GameInstanceSettings::Get();
     if (Prefab* playerUIPrefab = settings.PlayerUIPrefab.Get())
     {
-        return PrefabManager::SpawnPrefab(playerUIPrefab, nullptr, nullptr);
+        return SpawnPlayerPrefab(playerUIPrefab);
     }
     return nullptr;
 }
 
+void PlayerController::GetRelevancyViewpoints(Array<Vector3>& viewpoints) const
+{
+    const PlayerPawn* pawn = GetPlayerPawn();
+    if (const Actor* pawnActor = pawn ? pawn->GetActor() : nullptr)
+        viewpoints.Add(pawnActor->GetPosition());
+}
+
 void PlayerController::MovePawn(const Vector3& translation, const Quaternion& rotation)
 {
     // Ignore zero deltas
@@ -226,11 +549,13 @@ void PlayerController::MovePawn(const Vector3& translation, const Quaternion& ro
     if (!pawnActor)
         return;
 
-    // Replicate on server
+    // Accumulate movement to replicate on server (sent once per network update)
     const NetworkManagerMode networkMode = NetworkManager::Mode;
     if (networkMode == NetworkManagerMode::Client)
     {
-        MovePawnServer(translation, rotation);
+        _moveTranslation += translation;
+        _moveRotation = _moveRotation * rotation;
+        _hasMove = true;
     }
 
     // Perform local move
@@ -242,14 +567,140 @@ void PlayerController::OnMovePawn(Actor* pawnActor, const Vector3& translation,
     pawnActor->AddMovement(translation, rotation);
 }
 
-void PlayerController::MovePawnServer(const Vector3& translation, const Quaternion& rotation)
+void PlayerController::MovePawnServer(uint32 sequence, const Vector3& translation, const Quaternion& rotation)
+{
+    NETWORK_RPC_IMPL(PlayerController, MovePawnServer, sequence, translation, rotation);
+    ApplyMoveServer(sequence, translation, rotation);
+}
+
+void PlayerController::MovePawnServerCompact(uint32 sequence, int16 translationX, int16 translationY, int16 translationZ, uint32 rotation)
 {
-    NETWORK_RPC_IMPL(PlayerController, MovePawnServer, translation, rotation);
+    NETWORK_RPC_IMPL(PlayerController, MovePawnServerCompact, sequence, translationX, translationY, translationZ, rotation);
+    const float precision = GameInstanceSettings::Get()->MovementPrecision;
+    ApplyMoveServer(sequence, MovementQuantization::DecodeTranslation(translationX, translationY, translationZ, precision), MovementQuantization::DecodeRotation(rotation));
+}
+
+void PlayerController::ApplyMoveServer(uint32 sequence, const Vector3& translation, const Quaternion& rotation)
+{
+    // Skip outdated movement
+    if ((int32)(sequence - _moveSequence) <= 0)
+        return;
+    _moveSequence = sequence;
 
     if (OnValidateMove(translation, rotation))
     {
         MovePawn(translation, rotation);
     }
+
+    // Acknowledge the authoritative pawn location to let client correct its prediction
+    const PlayerPawn* pawn = GetPlayerPawn();
+    if (const Actor* pawnActor = pawn ? pawn->GetActor() : nullptr)
+        MovePawnAck(sequence, pawnActor->GetPosition(), pawnActor->GetOrientation());
+}
+
+void PlayerController::MovePawnAck(uint32 sequence, const Vector3& position, const Quaternion& orientation)
+{
+    NETWORK_RPC_IMPL(PlayerController, MovePawnAck, sequence, position, orientation);
+    if (NetworkManager::Mode != NetworkManagerMode::Client)
+        return;
+
+    // Remove acknowledged moves (the last one is used to compare the prediction against the server)
+    int32 ackIndex = -1;
+    for (int32 i = 0; i < _pendingMoves.Count(); i++)
+    {
+        const int32 diff = (int32)(_pendingMoves[i].Sequence - sequence);
+        if (diff > 0)
+            break;
+        if (diff == 0)
+            ackIndex = i;
+    }
+    if (ackIndex == -1)
+        return; // Outdated or unknown ack
+    const PendingMove ackMove = _pendingMoves[ackIndex];
+    RemoveFirstItems(_pendingMoves, ackIndex + 1);
+
+    // Skip if prediction matches the server (orientation dot of 0.9999 is about 1.6 degree)
+    const float threshold = GameInstanceSettings::Get()->MovementCorrectionThreshold;
+    if (Vector3::DistanceSquared(ackMove.Position, position) <= threshold * threshold &&
+        Math::Abs(Quaternion::Dot(ackMove.Orientation, orientation)) >= 0.9999f)
+        return;
+    const PlayerPawn* pawn = GetPlayerPawn();
+    Actor* pawnActor = pawn ? pawn->GetActor() : nullptr;
+    if (!pawnActor)
+        return;
+    PROFILE_CPU();
+
+    // Move to the authoritative location and replay movement not yet processed by the server
+    pawnActor->SetPosition(position);
+    pawnActor->SetOrientation(orientation);
+    for (PendingMove& move : _pendingMoves)
+    {
+        OnMovePawn(pawnActor, move.Translation, move.Rotation);
+        move.Position = pawnActor->GetPosition();
+        move.Orientation = pawnActor->GetOrientation();
+    }
+    if (!_moveTranslation.IsZero() || !_moveRotation.IsIdentity())
+        OnMovePawn(pawnActor, _moveTranslation, _moveRotation);
+}
+
+void PlayerController::AddPendingMove(const Vector3& translation, const Quaternion& rotation)
+{
+    const int32 bufferSize = Math::Max(GameInstanceSettings::Get()->MovementPredictionBufferSize, 1);
+    if (_pendingMoves.Count() >= bufferSize)
+        RemoveFirstItems(_pendingMoves, _pendingMoves.Count() - bufferSize + 1);
+
+    // Predicted location after the server applies this move (excluding movement that is still accumulated locally)
+    const PlayerPawn* pawn = GetPlayerPawn();
+    const Actor* pawnActor = pawn ? pawn->GetActor() : nullptr;
+    auto& move = _pendingMoves.AddOne();
+    move.Sequence = _moveSequence;
+    move.Translation = translation;
+    move.Rotation = rotation;
+    move.Position = pawnActor ? pawnActor->GetPosition() - _moveTranslation : Vector3::Zero;
+    move.Orientation = pawnActor ? pawnActor->GetOrientation() : Quaternion::Identity;
+}
+
+void PlayerController::SendMoves(bool flush)
+{
+    if (!_hasMove)
+        return;
+    const double time = Platform::GetTimeSeconds();
+    const float networkFPS = NetworkSettings::Get()->NetworkFPS;
+    if (!flush && networkFPS > 0.0f && time - _moveSendTime < 1.0 / networkFPS)
+        return;
+    PROFILE_CPU();
+
+    // Send merged movement delta to the server
+    _moveSendTime = time;
+    _moveSequence++;
+    const auto settings = GameInstanceSettings::Get();
+    int16 x, y, z;
+    if (!flush && settings->MovementEncoding == PawnMovementEncoding::Compact &&
+        MovementQuantization::EncodeTranslation(_moveTranslation, settings->MovementPrecision, x, y, z))
+    {
+        // Send quantized movement (14 bytes instead of 32 or 44 with double-precision vectors) and keep the quantization error to be sent with the next update so the server doesn't drift away from the client
+        const uint32 rotation = MovementQuantization::EncodeRotation(_moveRotation);
+        MovePawnServerCompact(_moveSequence, x, y, z, rotation);
+        const Vector3 sentTranslation = MovementQuantization::DecodeTranslation(x, y, z, settings->MovementPrecision);
+        const Quaternion sentRotation = MovementQuantization::DecodeRotation(rotation);
+        Quaternion sentRotationInv = sentRotation;
+        sentRotationInv.Invert();
+        _moveTranslation -= sentTranslation;
+        _moveRotation = sentRotationInv * _moveRotation;
+        _moveRotation.Normalize();
+        AddPendingMove(sentTranslation, sentRotation);
+    }
+    else
+    {
+        // Send full precision movement (flush uses it too to not leave any quantization error behind)
+        MovePawnServer(_moveSequence, _moveTranslation, _moveRotation);
+        const Vector3 sentTranslation = _moveTranslation;
+        const Quaternion sentRotation = _moveRotation;
+        _moveTranslation = Vector3::Zero;
+        _moveRotation = Quaternion::Identity;
+        AddPendingMove(sentTranslation, sentRotation);
+    }
+    _hasMove = false;
 }
 
 void PlayerController::OnUpdate()
@@ -258,11 +709,25 @@ void PlayerController::OnUpdate()
 
 void PlayerController::OnDestroy()
 {
+    Despawn();
+}
+
+void PlayerController::Despawn()
+{
+    // Send movement accumulated since the last network update, including the quantization error left by compact encoding (otherwise server would miss the last client moves)
+    if (NetworkManager::IsClient() && (_hasMove || !_moveTranslation.IsZero() || !_moveRotation.IsIdentity()))
+    {
+        _hasMove = true;
+        SendMoves(true);
+    }
+    _pendingMoves.Clear();
+
     if (_spawned)
     {
         if (_playerState)
         {
             _playerState->PlayerController = nullptr;
+            NetworkReplicator::DirtyObject(_playerState);
             _playerState = nullptr;
         }
         _spawned = false;
@@ -280,6 +745,13 @@ void PlayerUI::SetPlayerState(PlayerState* value)
 }
 
 void PlayerUI::OnDestroy()
+{
+    Despawn();
+
+    Script::OnDestroy();
+}
+
+void PlayerUI::Despawn()
 {
     // Unlink from player state
     if (_playerState)
@@ -287,12 +759,19 @@ void PlayerUI::OnDestroy()
         _playerState->PlayerUI = nullptr;
         _playerState = nullptr;
     }
-
-    Script::OnDestroy();
 }
 
 IMPLEMENT_GAME_SETTINGS_GETTER(GameInstanceSettings, "GameInstance");
 
+void GameInstanceSettings::Apply()
+{
+    ReplicationHierarchy::InvalidateSettings();
+    GameInstance::_sceneSystemFiltersDirty = true;
+}
+
+uint32 GameInstance::_systemsVersion = 1;
+bool GameInstance::_sceneSystemFiltersDirty = true;
+
 GameInstance::GameInstance(const SpawnParams& params)
     : GamePlugin(SpawnParams(Guid(0x12345678, 0x99634f61, 0x84723632, 0x54c776af), params.Type)) // Override ID to be the same on all clients (a cross-device singleton) to keep network id stable
 {
@@ -302,6 +781,18 @@ GameInstance::GameInstance(const SpawnParams& params)
 #endif
 }
 
+void GameInstance::SetSceneSystemFilter(const ScriptingTypeHandle& type, const SceneSystemFilter& filter)
+{
+    SceneSystemFiltersOverrides[type] = filter;
+    _sceneSystemFiltersDirty = true;
+}
+
+void GameInstance::RemoveSceneSystemFilter(const ScriptingTypeHandle& type)
+{
+    if (SceneSystemFiltersOverrides.Remove(type))
+        _sceneSystemFiltersDirty = true;
+}
+
 GameInstance* GameInstance::GetInstance()
 {
     return PluginManager::GetPlugin<GameInstance>();
@@ -309,6 +800,13 @@ GameInstance* GameInstance::GetInstance()
 
 GameSystem* GameInstance::GetGameSystem(const MClass* type)
 {
+    // Use cache via scripting type if possible
+    if (type)
+    {
+        const ScriptingTypeHandle typeHandle = Scripting::FindScriptingType(type->GetFullName());
+        if (typeHandle)
+            return GetGameSystem(typeHandle);
+    }
     for (auto* e : _systems)
     {
         if (e->Is(type))
@@ -319,61 +817,309 @@ GameSystem* GameInstance::GetGameSystem(const MClass* type)
 
 GameSystem* GameInstance::GetGameSystem(const ScriptingTypeHandle& type)
 {
+    GameSystem* result = nullptr;
+    if (IsSceneSystemJob)
+    {
+        // Scene systems initialized on worker threads can access only their dependencies (main thread can modify systems meanwhile)
+        _pendingSceneDependencies.TryGet(type, result);
+        return result;
+    }
+    if (_systemsCache.TryGet(type, result))
+        return result;
+    if ((_initWave || _tickWave) && !IsInMainThread())
+    {
+        // Main thread can modify systems meanwhile so worker threads can access only the systems warmed up in the cache (InitializeDependencies, TickReads and TickWrites)
+        LOG(Warning, "Game system {0} is not listed in dependencies of the system running on a worker thread", String(type.GetType().Fullname));
+        return nullptr;
+    }
     for (auto* e : _systems)
     {
         if (e->Is(type))
-            return e;
+        {
+            result = e;
+            break;
+        }
     }
-    return nullptr;
+    if (!_initWave && !_tickWave && IsInMainThread())
+    {
+        // Systems initialization and tick can read the cache from worker threads (warmed up before)
+        _systemsCache.Add(type, result);
+    }
+    return result;
+}
+
+void GameInstance::OnSystemsChanged()
+{
+    // Invalidate systems lookup
+    _systemsCache.Clear();
+    _systemsVersion++;
+    _tickWavesDirty = true;
+}
+
+void GameInstance::BuildTickWaves()
+{
+    PROFILE_CPU();
+    _tickWavesDirty = false;
+    _tickWavesHash = GetTickAccessHash(_systems);
+    Array<GameSystem*> systems;
+    Array<int32> systemWaves;
+    for (int32 phaseIndex = 0; phaseIndex < ARRAY_COUNT(_tickWaves); phaseIndex++)
+    {
+        const auto phase = (GameSystemTickPhases)(1 << phaseIndex);
+        auto& waves = _tickWaves[phaseIndex];
+        waves.Clear();
+
+        // Place each system in the wave after the last system that it conflicts with (keeps systems order for dependent data)
+        systems.Clear();
+        systemWaves.Clear();
+        for (GameSystem* system : _systems)
+        {
+            if (!EnumHasAnyFlags(system->TickPhases, phase))
+                continue;
+            int32 waveIndex = 0;
+            for (int32 i = 0; i < systems.Count(); i++)
+            {
+                if (systemWaves[i] >= waveIndex && TickAccessConflicts(system, systems[i]))
+                    waveIndex = systemWaves[i] + 1;
+            }
+            systems.Add(system);
+            systemWaves.Add(waveIndex);
+            if (waves.Count() <= waveIndex)
+                waves.Resize(waveIndex + 1);
+            auto& wave = waves[waveIndex];
+            if (system->TickThreadSafe)
+                wave.WorkerThread.Add(system);
+            else
+                wave.MainThread.Add(system);
+        }
+    }
+
+    // Warm up systems lookup for the accessed types so it's only read while worker threads run
+    for (GameSystem* system : _systems)
+    {
+        if (system->TickPhases == GameSystemTickPhases::None)
+            continue;
+        for (const ScriptingTypeHandle& e : system->TickReads)
+            GetGameSystem(e);
+        for (const ScriptingTypeHandle& e : system->TickWrites)
+            GetGameSystem(e);
+    }
+}
+
+void GameInstance::TickSystems(GameSystemTickPhases phase)
+{
+    if (_tickWavesDirty)
+        BuildTickWaves();
+    const auto& waves = _tickWaves[GetTickPhaseIndex(phase)];
+    if (waves.IsEmpty())
+        return;
+    PROFILE_CPU();
+    _tickPhase = phase;
+    for (const TickWave& wave : waves)
+    {
+        // Run thread-safe systems on job system (in parallel) and other systems on the main thread
+        int64 label = 0;
+        if (wave.WorkerThread.Count() > 1 || (wave.WorkerThread.Count() == 1 && wave.MainThread.HasItems()))
+        {
+            _tickWave = &wave;
+            Function<void(int32)> job;
+            job.Bind<GameInstance, &GameInstance::TickSystemJob>(this);
+            label = JobSystem::Dispatch(job, wave.WorkerThread.Count());
+        }
+        else if (wave.WorkerThread.HasItems())
+        {
+            wave.WorkerThread[0]->OnTick(phase);
+        }
+        for (GameSystem* system : wave.MainThread)
+            system->OnTick(phase);
+        if (label)
+            JobSystem::Wait(label);
+    }
+    _tickWave = nullptr;
+}
+
+void GameInstance::TickSystemJob(int32 index)
+{
+    _tickWave->WorkerThread[index]->OnTick(_tickPhase);
+}
+
+void GameInstance::InitializeSystems(Array<GameSystem*>& systems)
+{
+    PROFILE_CPU();
+
+    // Place each system in the wave after all of its dependencies (keeps systems order within the wave)
+    Array<int32> systemWaves;
+    GetInitializeWaves(systems, systemWaves, true);
+    Array<TickWave> waves;
+    for (int32 i = 0; i < systems.Count(); i++)
+    {
+        const int32 waveIndex = systemWaves[i];
+        if (waves.Count() <= waveIndex)
+            waves.Resize(waveIndex + 1);
+        auto& wave = waves[waveIndex];
+        if (systems[i]->InitializeThreadSafe)
+            wave.WorkerThread.Add(systems[i]);
+        else
+            wave.MainThread.Add(systems[i]);
+    }
+
+    for (int32 waveIndex = 0; waveIndex < waves.Count(); waveIndex++)
+    {
+        const TickWave& wave = waves[waveIndex];
+
+        // Warm up systems lookup for dependencies so it's only read while worker threads run
+        for (int32 i = 0; i < systems.Count(); i++)
+        {
+            if (systemWaves[i] != waveIndex)
+                continue;
+            for (const ScriptingTypeHandle& dependency : systems[i]->InitializeDependencies)
+                GetGameSystem(dependency);
+        }
+
+        // Run thread-safe systems on job system (in parallel) and other systems on the main thread
+        const int32 systemsStart = _systems.Count();
+        _initWave = &wave;
+        int64 label = 0;
+        if (wave.WorkerThread.Count() > 1 || (wave.WorkerThread.Count() == 1 && wave.MainThread.HasItems()))
+        {
+            Function<void(int32)> job;
+            job.Bind<GameInstance, &GameInstance::InitializeSystemJob>(this);
+            label = JobSystem::Dispatch(job, wave.WorkerThread.Count());
+        }
+        else if (wave.WorkerThread.HasItems())
+        {
+            InitializeSystem(wave.WorkerThread[0]);
+        }
+        for (GameSystem* system : wave.MainThread)
+        {
+            // Main thread systems are visible to the next ones right after initialization (lookup skips the cache)
+            InitializeSystem(system);
+            _systems.Add(system);
+            _systemsVersion++;
+        }
+        if (label)
+            JobSystem::Wait(label);
+        _initWave = nullptr;
+
+        // Register initialized systems (keep the original order within the wave)
+        _systems.Resize(systemsStart);
+        for (int32 i = 0; i < systems.Count(); i++)
+        {
+            if (systemWaves[i] == waveIndex)
+                _systems.Add(systems[i]);
+        }
+        OnSystemsChanged();
+    }
+}
+
+void GameInstance::InitializeSystemJob(int32 index)
+{
+    InitializeSystem(_initWave->WorkerThread[index]);
+}
+
+void GameInstance::InitializeSystem(GameSystem* system)
+{
+    const double startTime = Platform::GetTimeSeconds();
+    system->Initialize();
+    const float time = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+    LOG(Info, "Initialized game system {0} in {1} ms", String(system->GetType().Fullname), time);
+}
+
+void GameInstance::InitializeSceneSystemJob(int32 index)
+{
+    IsSceneSystemJob = true;
+    _pendingSceneSystems[index]->Initialize();
+    IsSceneSystemJob = false;
+}
+
+void GameInstance::FinishSceneSystems()
+{
+    if (!_pendingScene)
+        return;
+    PROFILE_CPU();
+
+    // Wait for async initialization and register scene systems
+    if (_pendingSceneLabel)
+    {
+        JobSystem::Wait(_pendingSceneLabel);
+        _pendingSceneLabel = 0;
+    }
+    _pendingSceneDependencies.Clear();
+    if (const auto* sceneSystems = _sceneSystems.TryGet(_pendingScene))
+    {
+        for (GameSceneSystem* system : *sceneSystems)
+        {
+            if (!_deferredSceneSystems.Contains(system))
+                _systems.Add(system);
+        }
+        OnSystemsChanged();
+    }
+
+    // Initialize systems that depend on other systems of this scene (each one is visible to the next ones)
+    for (GameSceneSystem* system : _deferredSceneSystems)
+    {
+        system->Initialize();
+        _systems.Add(system);
+        OnSystemsChanged();
+    }
+    _deferredSceneSystems.Clear();
+    _pendingSceneSystems.Clear();
+    _pendingScene = nullptr;
+}
+
+void GameInstance::OnScriptingUpdate()
+{
+    TickSystems(GameSystemTickPhases::Update);
+}
+
+void GameInstance::OnScriptingLateUpdate()
+{
+    TickSystems(GameSystemTickPhases::LateUpdate);
+    TickSystems(GameSystemTickPhases::PreNetwork);
 }
 
 void GameInstance::Initialize()
 {
+    PROFILE_CPU();
     GamePlugin::Initialize();
 
     // Find all game system types from all loaded binary modules
     _sceneSystemTypes.Clear();
+    _sceneSystemFiltersDirty = true;
+    Array<GameSystem*> systems;
     for (BinaryModule* e : BinaryModule::GetModules())
     {
-        for (int32 i = 0; i < e->Types.Count(); i++)
+        for (const int32 typeIndex : GetSystemTypes(e))
         {
-            const ScriptingType& type = e->Types[i];
-            const ScriptingTypeHandle typeHandle(e, i);
-            if (type.Type == ScriptingTypes::Script && typeHandle.IsSubclassOf(GameSystem::TypeInitializer))
+            const ScriptingTypeHandle typeHandle(e, typeIndex);
+            if (GameSceneSystem::TypeInitializer.IsAssignableFrom(typeHandle))
+            {
+                // Cache scene types
+                _sceneSystemTypes.Add(typeHandle);
+            }
+            else
             {
-                // Skip abstract types
-                if (type.ManagedClass && type.ManagedClass->IsAbstract())
+                // Spawn game system
+                const ScriptingObjectSpawnParams spawnParams(Guid::New(), typeHandle);
+                auto* system = (GameSystem*)typeHandle.GetType().Script.Spawn(spawnParams);
+                if (!system)
                     continue;
-
-                if (GameSceneSystem::TypeInitializer.IsAssignableFrom(typeHandle))
-                {
-                    // Cache scene types
-                    _sceneSystemTypes.Add(typeHandle);
-                }
+                system->_instance = this;
+                if (system->CanBeUsed())
+                    systems.Add(system);
                 else
-                {
-                    // Spawn game system
-                    const ScriptingObjectSpawnParams spawnParams(Guid::New(), typeHandle);
-                    auto* system = (GameSystem*)type.Script.Spawn(spawnParams);
-                    if (!system)
-                        continue;
-                    system->_instance = this;
-                    if (system->CanBeUsed())
-                    {
-                        system->Initialize();
-                        _systems.Add(system);
-                    }
-                    else
-                    {
-                        Delete(system);
-                    }
-                }
+                    Delete(system);
             }
         }
     }
 
+    // Initialize game systems (all of them are ready before game starts)
+    InitializeSystems(systems);
+
     // Register for network events
     Engine::Update.Bind<GameInstance, &GameInstance::OnUpdate>(this);
+    Scripting::Update.Bind<GameInstance, &GameInstance::OnScriptingUpdate>(this);
+    Scripting::LateUpdate.Bind<GameInstance, &GameInstance::OnScriptingLateUpdate>(this);
     NetworkManager::StateChanged.Bind<GameInstance, &GameInstance::OnNetworkStateChanged>(this);
     NetworkManager::ClientConnected.Bind<GameInstance, &GameInstance::OnNetworkClientConnected>(this);
     NetworkManager::ClientDisconnected.Bind<GameInstance, &GameInstance::OnNetworkClientDisconnected>(this);
@@ -382,6 +1128,7 @@ void GameInstance::Initialize()
     Level::ScenesLock.Lock();
     for (Scene* scene : Level::Scenes)
         OnSceneLoading(scene, scene->GetID());
+    FinishSceneSystems();
     Level::SceneLoading.Bind<GameInstance, &GameInstance::OnSceneLoading>(this);
     Level::SceneLoaded.Bind<GameInstance, &GameInstance::OnSceneLoaded>(this);
     Level::SceneUnloading.Bind<GameInstance, &GameInstance::OnSceneUnloading>(this);
@@ -393,6 +1140,7 @@ void GameInstance::Deinitialize()
 {
     // Ensure to stop any game
     EndGame();
+    ClearActorPools();
 
     // Unregister from events
     NetworkManager::StateChanged.Unbind<GameInstance, &GameInstance::OnNetworkStateChanged>(this);
@@ -403,12 +1151,17 @@ void GameInstance::Deinitialize()
     Level::SceneUnloading.Unbind<GameInstance, &GameInstance::OnSceneUnloading>(this);
     Level::SceneUnloaded.Unbind<GameInstance, &GameInstance::OnSceneUnloaded>(this);
     Engine::Update.Unbind<GameInstance, &GameInstance::OnUpdate>(this);
+    Scripting::Update.Unbind<GameInstance, &GameInstance::OnScriptingUpdate>(this);
+    Scripting::LateUpdate.Unbind<GameInstance, &GameInstance::OnScriptingLateUpdate>(this);
+    FinishSceneSystems();
+    _sceneSystems.Clear();
 
     // Shutdown game systems (reversed order)
     for (int32 i = _systems.Count() - 1; i >= 0; i--)
     {
         GameSystem* system = _systems[i];
         _systems.RemoveAt(i);
+        OnSystemsChanged();
         system->Deinitialize();
         Delete(system);
     }
@@ -419,123 +1172,368 @@ void GameInstance::Deinitialize()
 
 void GameInstance::OnUpdate()
 {
+    // Rebuild tick waves if any system changed its tick phases or accessed data
+    if (!_tickWavesDirty && GetTickAccessHash(_systems) != _tickWavesHash)
+        _tickWavesDirty = true;
+    TickSystems(GameSystemTickPhases::PreInput);
+
     if (!_gameStarted || Time::GetGamePaused())
         return;
     PROFILE_CPU();
 
-    // Process players spawn events (ensure that both pawn and controller are ready on server and client)
-    for (int32 i = 0; i < _playersToSpawn.Count() && _playersToSpawn.Count() != 0; i++)
+    // Create players for newly connected clients
+    if (_clientsToJoin.HasItems())
+        ProcessClientsToJoin();
+
+    // Spawn players that are ready (pawn and controller got replicated on both server and client), limit the amount per-frame to reduce hitches
+    if (_playersReadyToSpawn.HasItems())
     {
-        const uint32 playerId = _playersToSpawn[i];
-        if (PlayerState* playerState = _gameState->GetPlayerStateByPlayerId(playerId))
+        const auto& settings = *GameInstanceSettings::Get();
+        const int32 maxSpawns = settings.MaxPlayerSpawnsPerFrame > 0 ? settings.MaxPlayerSpawnsPerFrame : MAX_int32;
+        int32 processed = 0, spawned = 0;
+        for (; processed < _playersReadyToSpawn.Count() && spawned < maxSpawns; processed++)
         {
-            const bool needController = !NetworkManager::IsClient() || playerState->NetworkClientId == NetworkManager::LocalClientId;
-            if (playerState->PlayerPawn == nullptr || playerState->PlayerPawn->GetPlayerId() != playerId)
-                continue;
-            if (playerState->PlayerPawn->_spawned)
+            const uint32 playerId = _playersReadyToSpawn[processed];
+            PlayerState* playerState;
+            const uint8 missing = GetPlayerSpawnMissingParts(playerId, playerState);
+            if (missing != 0)
             {
-                // Already spawned
-                _playersToSpawn.RemoveAtKeepOrder(i--);
+                // Player got invalidated in the meantime so wait for it again
+                _playersToSpawn[playerId] = missing;
                 continue;
             }
-            if (needController && playerState->PlayerController == nullptr)
+            if (playerState->PlayerPawn->_spawned)
                 continue;
-            if (Level::Scenes.IsEmpty())
-                break;
+            SpawnPlayer(playerState);
+            spawned++;
+        }
+        if (processed == _playersReadyToSpawn.Count())
+        {
+            _playersReadyToSpawn.Clear();
+        }
+        else
+        {
+            const int32 left = _playersReadyToSpawn.Count() - processed;
+            for (int32 i = 0; i < left; i++)
+                _playersReadyToSpawn[i] = _playersReadyToSpawn[processed + i];
+            _playersReadyToSpawn.Resize(left);
+        }
+    }
+    else if (_actorPools.HasItems())
+    {
+        // Use idle frames to refill pools
+        UpdateActorPools();
+    }
+
+    // Send movement accumulated by local players during the last frame
+    if (NetworkManager::IsClient())
+    {
+        for (PlayerState* playerState : _gameState->GetPlayerStatesByNetworkClientId(NetworkManager::LocalClientId))
+        {
+            if (playerState->PlayerController)
+                playerState->PlayerController->SendMoves();
+        }
+    }
+
+    // Update inputs (before scripting update)
+    const PlayerState* localPlayerState = GetLocalPlayerState();
+    if (localPlayerState && localPlayerState->PlayerController && localPlayerState->PlayerController->_spawned)
+    {
+        localPlayerState->PlayerController->OnUpdateInput();
+    }
+}
+
+PlayerState* GameInstance::GetLocalPlayerState() const
+{
+    return _gameState ? _gameState->GetPlayerStateByNetworkClientId(NetworkManager::LocalClientId) : nullptr;
+}
+
+Array<PlayerState*, InlinedAllocation<8>> GameInstance::GetLocalPlayerStates() const
+{
+    Array<PlayerState*, InlinedAllocation<8>> result;
+    if (_gameState)
+        result = _gameState->GetPlayerStatesByNetworkClientId(NetworkManager::LocalClientId);
+    return result;
+}
 
-            Actor* pawnActor = playerState->PlayerPawn->GetParent();
-            Actor* controllerActor = playerState->PlayerController ? playerState->PlayerController->GetParent() : nullptr;
+void GameInstance::SpawnPlayer(PlayerState* playerState)
+{
+    PROFILE_CPU();
+    const uint32 playerId = playerState->PlayerId;
+    Actor* pawnActor = playerState->PlayerPawn->GetParent();
+    Actor* controllerActor = playerState->PlayerController ? playerState->PlayerController->GetParent() : nullptr;
 
 #if !BUILD_RELEASE
-            // Set proper name for the player actors to improve dev usage
-            ASSERT(pawnActor);
-            if (pawnActor)
-                pawnActor->SetName(String::Format(TEXT("Player Pawn PlayerId={}"), playerId));
-            if (controllerActor)
-                controllerActor->SetName(String::Format(TEXT("Player Controller PlayerId={}"), playerId));
+    // Set proper name for the player actors to improve dev usage
+    ASSERT(pawnActor);
+    if (pawnActor)
+        pawnActor->SetName(String::Format(TEXT("Player Pawn PlayerId={}"), playerId));
+    if (controllerActor)
+        controllerActor->SetName(String::Format(TEXT("Player Controller PlayerId={}"), playerId));
 #endif
 
-            // Ensure that player exists on a level (could be unlinked due to level transition when starting game)
-            if (!pawnActor->GetParent())
-            {
-                Level::SpawnActor(pawnActor);
-                _sceneTransitionActors.Remove(pawnActor);
-            }
-            if (controllerActor && !controllerActor->GetParent())
-            {
-                Level::SpawnActor(controllerActor);
-                _sceneTransitionActors.Remove(controllerActor);
-            }
+    // Ensure that player exists on a level (could be unlinked due to level transition when starting game)
+    if (!pawnActor->GetParent())
+    {
+        _sceneTransitionActors.Remove(pawnActor);
+        SpawnPlayerActor(pawnActor);
+    }
+    if (controllerActor && !controllerActor->GetParent())
+    {
+        _sceneTransitionActors.Remove(controllerActor);
+        SpawnPlayerActor(controllerActor);
+    }
 
-            // Spawn player
-            playerState->PlayerPawn->_spawned = true;
-            playerState->PlayerPawn->SetPlayerState(playerState);
-            if (playerState->PlayerController)
-            {
-                playerState->PlayerController->_spawned = true;
-                playerState->PlayerController->_playerState = playerState;
-            }
-            playerState->PlayerPawn->OnPlayerSpawned();
-            if (playerState->PlayerController)
-                playerState->PlayerController->OnPlayerSpawned();
-            _playersToSpawn.RemoveAtKeepOrder(i--);
+    // Spawn player
+    playerState->PlayerPawn->_spawned = true;
+    playerState->PlayerPawn->SetPlayerState(playerState);
+    if (playerState->PlayerController)
+    {
+        playerState->PlayerController->_spawned = true;
+        playerState->PlayerController->_playerState = playerState;
+    }
+    playerState->PlayerPawn->OnPlayerSpawned();
+    if (playerState->PlayerController)
+        playerState->PlayerController->OnPlayerSpawned();
+
+    // Create UI for local player
+    if (playerState->NetworkClientId == NetworkManager::LocalClientId)
+    {
+        Actor* uiActor = playerState->PlayerController->CreatePlayerUI(playerState);
+        PlayerUI* uiScript = Utilities::GetActiveScript<PlayerUI>(uiActor);
+        if (uiActor && !uiScript)
+        {
+            LOG(Error, "Invalid player UI actor spawned without PlayerUI script attached (to the root actor).");
+            Delete(uiActor);
+            uiActor = nullptr;
+        }
+        if (!uiActor)
+        {
+            // Fallback to default UI
+            uiActor = New<EmptyActor>();
+            uiScript = uiActor->AddScript<PlayerUI>();
+        }
+        uiScript->SetPlayerState(playerState);
+        playerState->PlayerUI = uiScript;
+#if !BUILD_RELEASE
+        uiActor->SetName(String::Format(TEXT("Player UI PlayerId={}"), playerId));
+#endif
+        SpawnPlayerActor(uiActor);
+        uiScript->OnPlayerSpawned();
+    }
+
+    // Custom logic after spawning player
+    PlayerSpawned(playerState->PlayerPawn);
+}
+
+void GameInstance::SpawnPlayerActor(Actor* actor)
+{
+    if (_playersRoot)
+    {
+        // Link to the persistent players root (it gets moved as a whole during scene transitions)
+        actor->SetParent(_playersRoot, false);
+    }
+    else if (Level::Scenes.HasItems())
+    {
+        Level::SpawnActor(actor);
+    }
+    else
+    {
+        _sceneTransitionActors.Add(actor);
+    }
+}
+
+uint8 GameInstance::GetPlayerSpawnMissingParts(uint32 playerId, PlayerState*& playerState) const
+{
+    playerState = _gameState ? _gameState->GetPlayerStateByPlayerId(playerId) : nullptr;
+    if (!playerState)
+        return SpawnState;
+    uint8 missing = 0;
+    if (playerState->PlayerPawn == nullptr || playerState->PlayerPawn->GetPlayerId() != playerId)
+        missing |= SpawnPawn;
+    const bool needController = !NetworkManager::IsClient() || playerState->NetworkClientId == NetworkManager::LocalClientId;
+    if (needController && playerState->PlayerController == nullptr)
+        missing |= SpawnController;
+    if (Level::Scenes.IsEmpty())
+        missing |= SpawnScene;
+    return missing;
+}
+
+void GameInstance::QueuePlayerSpawn(uint32 playerId)
+{
+    if (_playersToSpawn.ContainsKey(playerId) || _playersReadyToSpawn.Contains(playerId))
+        return;
+    _playersToSpawn.Add(playerId, MAX_uint8);
+    UpdatePlayerSpawn(playerId);
+}
+
+void GameInstance::UpdatePlayerSpawn(uint32 playerId)
+{
+    uint8* missing = _playersToSpawn.TryGet(playerId);
+    if (!missing)
+        return;
+    PlayerState* playerState;
+    *missing = GetPlayerSpawnMissingParts(playerId, playerState);
+    if (playerState && (*missing & SpawnPawn) == 0 && playerState->PlayerPawn->_spawned)
+    {
+        // Already spawned
+        _playersToSpawn.Remove(playerId);
+    }
+    else if (*missing == 0)
+    {
+        // Ready to spawn
+        _playersToSpawn.Remove(playerId);
+        _playersReadyToSpawn.Add(playerId);
+    }
+}
+
+void GameInstance::UpdatePlayerSpawns(uint8 parts)
+{
+    Array<uint32, InlinedAllocation<8>> playerIds;
+    for (const auto& e : _playersToSpawn)
+    {
+        if (e.Value & parts)
+            playerIds.Add(e.Key);
+    }
+    for (const uint32 playerId : playerIds)
+        UpdatePlayerSpawn(playerId);
+}
+
+void GameInstance::CancelPlayerSpawn(uint32 playerId)
+{
+    _playersToSpawn.Remove(playerId);
+    _playersReadyToSpawn.Remove(playerId);
+}
+
+Actor* GameInstance::SpawnPooledPrefab(Prefab* prefab)
+{
+    if (!prefab)
+        return nullptr;
+    if (auto* pool = _actorPools.TryGet(prefab->GetID()))
+    {
+        while (pool->Actors.HasItems())
+        {
+            Actor* actor = pool->Actors.Pop();
+            if (!actor)
+                continue;
 
-            // Create UI for local player
-            if (playerState->NetworkClientId == NetworkManager::LocalClientId)
+            // Spawn reused player pawns for replication again (engine starts scripts only once, fresh instances get spawned on start)
+            for (Script* script : actor->Scripts)
             {
-                Actor* uiActor = playerState->PlayerController->CreatePlayerUI(playerState);
-                PlayerUI* uiScript = Utilities::GetActiveScript<PlayerUI>(uiActor);
-                if (uiActor && !uiScript)
+                auto* pawn = ScriptingObject::Cast<PlayerPawn>(script);
+                if (pawn && pawn->_released)
                 {
-                    LOG(Error, "Invalid player UI actor spawned without PlayerUI script attached (to the root actor).");
-                    Delete(uiActor);
-                    uiActor = nullptr;
+                    pawn->_released = false;
+                    pawn->SpawnNetwork();
                 }
-                if (!uiActor)
-                {
-                    // Fallback to default UI
-                    uiActor = New<EmptyActor>();
-                    uiScript = uiActor->AddScript<PlayerUI>();
-                }
-                uiScript->SetPlayerState(playerState);
-                playerState->PlayerUI = uiScript;
-#if !BUILD_RELEASE
-                uiActor->SetName(String::Format(TEXT("Player UI PlayerId={}"), playerId));
-#endif
-                Level::SpawnActor(uiActor);
-                uiScript->OnPlayerSpawned();
             }
+            return actor;
+        }
+    }
+    return PrefabManager::SpawnPrefab(prefab, nullptr, nullptr);
+}
+
+void GameInstance::ReleasePooledActor(Actor* actor)
+{
+    if (!actor)
+        return;
+    PROFILE_CPU();
+
+    // Networked objects lifetime is controlled by the replication system
+    if (NetworkReplicator::GetObjectRole(actor) != NetworkObjectRole::None)
+    {
+        if (NetworkManager::IsClient())
+            actor->DeleteObject();
+        else
+            NetworkReplicator::DespawnObject(actor);
+        return;
+    }
+
+    // Skip if pool is already full
+    auto* pool = _actorPools.TryGet(actor->GetPrefabID());
+    if (!pool || pool->Actors.Count() >= pool->Size || !pool->Asset)
+    {
+        actor->DeleteObject();
+        return;
+    }
 
-            // Custom logic after spawning player
-            PlayerSpawned(playerState->PlayerPawn);
+    // Reset player scripts state (as they were destroyed)
+    for (Script* script : actor->Scripts)
+    {
+        if (auto* pawn = ScriptingObject::Cast<PlayerPawn>(script))
+        {
+            pawn->Despawn();
+            pawn->_playerState = nullptr;
+            pawn->_playerId = MAX_uint32;
+            pawn->_networkSpawned = false;
+            pawn->_released = true;
+        }
+        else if (auto* controller = ScriptingObject::Cast<PlayerController>(script))
+        {
+            controller->Despawn();
+            controller->_playerState = nullptr;
+        }
+        else if (auto* ui = ScriptingObject::Cast<PlayerUI>(script))
+        {
+            ui->Despawn();
         }
     }
 
-    // Update inputs (before scripting update)
-    const PlayerState* localPlayerState = GetLocalPlayerState();
-    if (localPlayerState && localPlayerState->PlayerController && localPlayerState->PlayerController->_spawned)
+    // Unlink from level and restore default state of the prefab
+    actor->SetParent(nullptr, false);
+    _sceneTransitionActors.Remove(actor);
+    if (Actor* defaultInstance = pool->Asset->GetDefaultInstance())
     {
-        localPlayerState->PlayerController->OnUpdateInput();
+        actor->SetLocalTransform(defaultInstance->GetLocalTransform());
+        actor->SetName(defaultInstance->GetName());
     }
+    pool->Actors.Add(actor);
 }
 
-PlayerState* GameInstance::GetLocalPlayerState() const
+void GameInstance::WarmActorPool(Prefab* prefab, int32 size)
 {
-    return _gameState ? _gameState->GetPlayerStateByNetworkClientId(NetworkManager::LocalClientId) : nullptr;
+    if (!prefab || size <= 0)
+        return;
+    PROFILE_CPU();
+    auto& pool = _actorPools[prefab->GetID()];
+    pool.Asset = prefab;
+    pool.Size = size;
+    while (pool.Actors.Count() < pool.Size)
+    {
+        Actor* actor = PrefabManager::SpawnPrefab(prefab, nullptr, nullptr);
+        if (!actor)
+            break;
+        pool.Actors.Add(actor);
+    }
 }
 
-Array<PlayerState*, InlinedAllocation<8>> GameInstance::GetLocalPlayerStates() const
+void GameInstance::UpdateActorPools()
 {
-    Array<PlayerState*, InlinedAllocation<8>> result;
-    if (_gameState)
+    // Refill pools gradually (one instance per frame) to keep them warm for the next players (eg. when network objects got despawned instead of returned to the pool)
+    for (auto& e : _actorPools)
     {
-        for (PlayerState* playerState : _gameState->PlayerStates)
+        ActorPool& pool = e.Value;
+        if (pool.Actors.Count() < pool.Size && pool.Asset)
         {
-            if (playerState && playerState->NetworkClientId == NetworkManager::LocalClientId)
-                result.Add(playerState);
+            PROFILE_CPU();
+            if (Actor* actor = PrefabManager::SpawnPrefab(pool.Asset.Get(), nullptr, nullptr))
+                pool.Actors.Add(actor);
+            break;
         }
     }
-    return result;
+}
+
+void GameInstance::ClearActorPools()
+{
+    for (auto& e : _actorPools)
+    {
+        for (Actor* actor : e.Value.Actors)
+        {
+            if (actor)
+                actor->DeleteObject();
+        }
+    }
+    _actorPools.Clear();
 }
 
 void GameInstance::StartGame()
@@ -565,6 +1563,28 @@ void GameInstance::StartGame()
     _gameState = settings.GameStateType.NewObject();
     NetworkReplicator::AddObject(_gameState, this);
 
+    // Create persistent root for player actors (registered on both server and clients so replicated player actors can be linked to it)
+    if (settings.UsePlayersRoot)
+    {
+        // Use the same ID on all peers to be matched by the replication (as a cross-device singleton)
+        _playersRoot = New<EmptyActor>(ScriptingObjectSpawnParams(Guid(0x12345678, 0x99634f61, 0x84723632, 0x54c776b0), EmptyActor::TypeInitializer));
+        _playersRoot->SetName(TEXT("Players"));
+        NetworkReplicator::AddObject(_playersRoot, this);
+        if (Level::Scenes.HasItems())
+            Level::SpawnActor(_playersRoot);
+    }
+
+    // Prepare pooled player actors upfront to reduce hitches when players join
+    if (_isHosting)
+    {
+        WarmActorPool(settings.PlayerPawnPrefab.Get(), settings.PlayerPawnPoolSize);
+        WarmActorPool(settings.PlayerControllerPrefab.Get(), settings.PlayerControllerPoolSize);
+    }
+    if (networkMode != NetworkManagerMode::Server)
+    {
+        WarmActorPool(settings.PlayerUIPrefab.Get(), settings.PlayerUIPoolSize);
+    }
+
     if (_isHosting)
     {
         _gameMode->StartGame();
@@ -603,17 +1623,26 @@ void GameInstance::EndGame()
         {
             if (playerState)
             {
-                DeleteScript(playerState->PlayerUI);
-                DeleteScript(playerState->PlayerController);
-                DeleteScript(playerState->PlayerPawn);
+                ReleaseScript(this, playerState->PlayerUI);
+                ReleaseScript(this, playerState->PlayerController);
+                ReleaseScript(this, playerState->PlayerPawn);
                 playerState->DeleteObject();
             }
         }
         _gameState->DeleteObject();
         _gameState = nullptr;
     }
+    if (_playersRoot)
+    {
+        NetworkReplicator::RemoveObject(_playersRoot);
+        _playersRoot->DeleteObject();
+        _playersRoot = nullptr;
+    }
     _sceneTransitionActors.Clear();
     _sceneTransitionPlayers.Clear();
+    _playersToSpawn.Clear();
+    _playersReadyToSpawn.Clear();
+    _clientsToJoin.Clear();
     if (_isHosting)
     {
         _gameMode->DeleteObject();
@@ -627,7 +1656,11 @@ void GameInstance::EndGame()
 
 PlayerState* GameInstance::SpawnLocalPlayer()
 {
-    return CreatePlayer(NetworkManager::LocalClient);
+    PlayerState* playerState = CreatePlayer(NetworkManager::LocalClient);
+    Array<PlayerState*> playerStates;
+    playerStates.Add(playerState);
+    OnPlayersJoined(playerStates);
+    return playerState;
 }
 
 void GameInstance::OnNetworkStateChanged()
@@ -660,57 +1693,141 @@ void GameInstance::OnNetworkClientConnected(NetworkClient* client)
 {
     if (NetworkManager::IsClient() || !_gameStarted)
         return;
-    CreatePlayer(client);
+
+    // Queue client to be processed in batch with others (eg. many clients connecting at once after server restart)
+    _clientsToJoin.AddUnique(client);
 }
 
 void GameInstance::OnNetworkClientDisconnected(NetworkClient* client)
 {
     if (NetworkManager::IsClient() || !_gameStarted)
         return;
+    ReplicationHierarchy::ClearClientGroups(client->ClientId);
+
+    // Skip client that didn't join yet
+    if (_clientsToJoin.Remove(client))
+        return;
 
     // Remove player(s) from that client
-    for (int32 i = 0; i < _gameState->PlayerStates.Count(); i++)
+    for (PlayerState* playerState : _gameState->GetPlayerStatesByNetworkClientId(client->ClientId))
     {
-        auto playerState = _gameState->PlayerStates[i];
-        if (playerState && playerState->NetworkClientId == client->ClientId)
-        {
-            _gameMode->OnPlayerLeft(playerState);
-            _gameState->PlayerStates.RemoveAtKeepOrder(i--);
-            DeleteScript(playerState->PlayerUI);
-            NetworkReplicator::DespawnObject(playerState->PlayerController);
-            NetworkReplicator::DespawnObject(playerState->PlayerPawn);
-            NetworkReplicator::DespawnObject(playerState);
-        }
+        _gameMode->OnPlayerLeft(playerState);
+        _gameState->RemovePlayerState(playerState);
+        ReleaseScript(this, playerState->PlayerUI);
+        ReleaseScript(this, playerState->PlayerController);
+        ReleaseScript(this, playerState->PlayerPawn);
+        NetworkReplicator::DespawnObject(playerState);
     }
 }
 
 void GameInstance::OnSceneLoading(Scene* scene, const Guid& sceneId)
 {
-    for (const ScriptingTypeHandle& typeHandle : _sceneSystemTypes)
+    _sceneSystemsCreated = 0;
+    _sceneSystemsUsed = 0;
+    if (_sceneSystemTypes.IsEmpty())
+        return;
+    PROFILE_CPU();
+    FinishSceneSystems();
+    if (_sceneSystemFiltersDirty)
+    {
+        // Resolve filters for all scene system types (code has priority over settings)
+        _sceneSystemFiltersDirty = false;
+        const auto& settings = *GameInstanceSettings::Get();
+        _sceneSystemFilters.Resize(_sceneSystemTypes.Count());
+        for (int32 i = 0; i < _sceneSystemTypes.Count(); i++)
+            _sceneSystemFilters[i] = SceneSystemFilter();
+        for (const auto& e : settings.SceneSystemFilters)
+        {
+            const int32 index = _sceneSystemTypes.Find(e.Key.GetType());
+            if (index != -1)
+                _sceneSystemFilters[index] = e.Value;
+        }
+        for (const auto& e : SceneSystemFiltersOverrides)
+        {
+            const int32 index = _sceneSystemTypes.Find(e.Key);
+            if (index != -1)
+                _sceneSystemFilters[index] = e.Value;
+        }
+    }
+    auto& sceneSystems = _sceneSystems[scene];
+    for (int32 typeIndex = 0; typeIndex < _sceneSystemTypes.Count(); typeIndex++)
     {
+        // Skip systems not used by this scene before spawning them
+        if (!_sceneSystemFilters[typeIndex].Check(scene, sceneId))
+            continue;
+        const ScriptingTypeHandle& typeHandle = _sceneSystemTypes[typeIndex];
         const ScriptingObjectSpawnParams spawnParams(Guid::New(), typeHandle);
         auto* system = (GameSceneSystem*)typeHandle.GetType().Script.Spawn(spawnParams);
         if (!system)
             continue;
         system->_instance = this;
         system->_scene = scene;
+        _sceneSystemsCreated++;
         if (system->CanBeUsed())
         {
-            system->Initialize();
-            _systems.Add(system);
+            _sceneSystemsUsed++;
+            sceneSystems.Add(system);
         }
         else
         {
             Delete(system);
         }
     }
+
+    // Systems without dependencies within this scene are initialized right away, others once scene gets loaded (in dependency order)
+    Array<int32> systemWaves;
+    GetInitializeWaves(sceneSystems, systemWaves, false);
+    for (int32 waveIndex = 1; waveIndex < sceneSystems.Count(); waveIndex++)
+    {
+        for (int32 i = 0; i < sceneSystems.Count(); i++)
+        {
+            if (systemWaves[i] == waveIndex)
+                _deferredSceneSystems.Add(sceneSystems[i]);
+        }
+    }
+    for (int32 i = 0; i < sceneSystems.Count(); i++)
+    {
+        GameSceneSystem* system = sceneSystems[i];
+        if (systemWaves[i] != 0)
+            continue;
+        if (system->InitializeThreadSafe)
+        {
+            // Resolve dependencies upfront so worker thread doesn't access systems lookup
+            _pendingSceneSystems.Add(system);
+            for (const ScriptingTypeHandle& dependency : system->InitializeDependencies)
+                _pendingSceneDependencies[dependency] = GetGameSystem(dependency);
+        }
+        else
+        {
+            system->Initialize();
+        }
+    }
+
+    // Initialize thread-safe systems on job system while scene data gets loaded (systems are registered once scene gets loaded)
+    _pendingScene = scene;
+    if (_pendingSceneSystems.HasItems())
+    {
+        Function<void(int32)> job;
+        job.Bind<GameInstance, &GameInstance::InitializeSceneSystemJob>(this);
+        _pendingSceneLabel = JobSystem::Dispatch(job, _pendingSceneSystems.Count());
+    }
+    else
+    {
+        FinishSceneSystems();
+    }
 }
 
 void GameInstance::OnSceneLoaded(Scene* scene, const Guid& sceneId)
 {
+    if (_pendingScene == scene)
+        FinishSceneSystems();
+
     // If game performed scene transition, then respawn any cached scene objects
     if (_gameStarted)
     {
+        PROFILE_CPU();
+        if (_playersRoot && !_playersRoot->GetParent())
+            _playersRoot->SetParent(scene);
         for (Actor* a : _sceneTransitionActors)
             a->SetParent(scene);
         _sceneTransitionActors.Clear();
@@ -721,6 +1838,9 @@ void GameInstance::OnSceneLoaded(Scene* scene, const Guid& sceneId)
         }
         _sceneTransitionPlayers.Clear();
     }
+
+    // Players waiting for the level can be spawned now
+    UpdatePlayerSpawns(SpawnScene);
 }
 
 void GameInstance::OnSceneUnloading(Scene* scene, const Guid& sceneId)
@@ -728,24 +1848,35 @@ void GameInstance::OnSceneUnloading(Scene* scene, const Guid& sceneId)
     // If game performs scene transition, then unlink any scene objects (player pawn/controller/ui actors) to be respawned after new map gets loaded
     if (_gameStarted)
     {
+        PROFILE_CPU();
+
+        // Unlink the whole players root at once (no per-player actors relinking)
+        const bool rootUnloading = _playersRoot && _playersRoot->GetScene() == scene;
+        if (rootUnloading)
+            _playersRoot->SetParent(nullptr);
+
+        // Unlink player actors that are not under the players root
         for (int32 i = 0; i < _gameState->PlayerStates.Count(); i++)
         {
             auto playerState = _gameState->PlayerStates[i];
             if (playerState)
             {
                 Actor* a;
+                bool transition = !_playersRoot || rootUnloading;
 #define TRANSITION_SCRIPT(s) \
                 a = playerState->s ? playerState->s->GetActor() : nullptr; \
                 if (a && a->GetScene() == scene) \
                 { \
                     _sceneTransitionActors.Add(a); \
                     a->SetParent(nullptr); \
+                    transition = true; \
                 }
                 TRANSITION_SCRIPT(PlayerUI);
                 TRANSITION_SCRIPT(PlayerController);
                 TRANSITION_SCRIPT(PlayerPawn);
 #undef TRANSITION_SCRIPT
-                _sceneTransitionPlayers.Add(playerState);
+                if (transition)
+                    _sceneTransitionPlayers.Add(playerState);
             }
         }
     }
@@ -753,15 +1884,58 @@ void GameInstance::OnSceneUnloading(Scene* scene, const Guid& sceneId)
 
 void GameInstance::OnSceneUnloaded(Scene* scene, const Guid& sceneId)
 {
-    for (int32 i = _systems.Count() - 1; i >= 0; i--)
+    // Pending scene systems could use the systems of the unloaded scene
+    FinishSceneSystems();
+    auto* entry = _sceneSystems.TryGet(scene);
+    if (!entry)
+        return;
+    PROFILE_CPU();
+    Array<GameSceneSystem*> sceneSystems = MoveTemp(*entry);
+    _sceneSystems.Remove(scene);
+    for (GameSceneSystem* system : sceneSystems)
+        _systems.Remove(system);
+    OnSystemsChanged();
+
+    // Shutdown scene systems (reversed order)
+    for (int32 i = sceneSystems.Count() - 1; i >= 0; i--)
     {
-        auto* system = Cast<GameSceneSystem>(_systems[i]);
-        if (!system || system->_scene != scene)
-            continue;
-        _systems.RemoveAt(i);
-        system->Deinitialize();
-        Delete(system);
+        sceneSystems[i]->Deinitialize();
+        Delete(sceneSystems[i]);
+    }
+}
+
+void GameInstance::ProcessClientsToJoin()
+{
+    PROFILE_CPU();
+    const auto& settings = *GameInstanceSettings::Get();
+    const double timeBudget = settings.PlayerJoinTimeBudget > 0.0f ? settings.PlayerJoinTimeBudget * 0.001 : MAX_double;
+    const double startTime = Platform::GetTimeSeconds();
+
+    // Create players within a time budget (all network objects spawned within the same frame are sent by replicator in a single batch)
+    Array<PlayerState*> playerStates;
+    int32 processed = 0;
+    while (processed < _clientsToJoin.Count())
+    {
+        NetworkClient* client = _clientsToJoin[processed++];
+        if (client->State == NetworkConnectionState::Connected)
+            playerStates.Add(CreatePlayer(client));
+        if (Platform::GetTimeSeconds() - startTime >= timeBudget)
+            break;
+    }
+    if (processed == _clientsToJoin.Count())
+    {
+        _clientsToJoin.Clear();
     }
+    else
+    {
+        const int32 left = _clientsToJoin.Count() - processed;
+        for (int32 i = 0; i < left; i++)
+            _clientsToJoin[i] = _clientsToJoin[processed + i];
+        _clientsToJoin.Resize(left);
+    }
+
+    if (playerStates.HasItems())
+        OnPlayersJoined(playerStates);
 }
 
 PlayerState* GameInstance::CreatePlayer(NetworkClient* client)
@@ -774,7 +1948,8 @@ PlayerState* GameInstance::CreatePlayer(NetworkClient* client)
     else
         playerState->NetworkClientId = NetworkManager::LocalClientId;
     playerState->PlayerId = _gameState->NextPlayerId++; // TODO: for local coop use RPC to synchronize remote session with server
-    _gameState->PlayerStates.Add(playerState);
+    _gameState->AddPlayerState(playerState);
+    NetworkReplicator::DirtyObject(_gameState);
     NetworkReplicator::AddObject(playerState, this);
     NetworkReplicator::SpawnObject(playerState);
 
@@ -798,12 +1973,8 @@ PlayerState* GameInstance::CreatePlayer(NetworkClient* client)
     playerState->PlayerPawn = pawnScript;
 
     // Spawn player pawn on all connected clients and locally
-    const bool canSpawn = Level::Scenes.HasItems();
     NetworkReplicator::SpawnObject(pawnActor);
-    if (canSpawn)
-        Level::SpawnActor(pawnActor);
-    else
-        _sceneTransitionActors.Add(pawnActor);
+    SpawnPlayerActor(pawnActor);
 
     // Create player controller
     Actor* controllerActor = _gameMode->CreatePlayerController(playerState);
@@ -826,40 +1997,33 @@ PlayerState* GameInstance::CreatePlayer(NetworkClient* client)
     if (NetworkManager::IsConnected())
     {
         // Spawn player controller on connected client and locally (client ownership over controller)
-        if (NetworkManager::LocalClientId != playerState->NetworkClientId)
-        {
-            const uint32 controllerTargetsData[2] = { NetworkManager::LocalClientId, playerState->NetworkClientId };
-            const DataContainer<uint32> controllerTargets(controllerTargetsData, ARRAY_COUNT(controllerTargetsData));
-            // TODO: support inheritance of targetClientIds for spawned objects so if we set it for controller actor, all attached scripts to it will inherit that too
-            NetworkReplicator::SpawnObject(controllerActor, controllerTargets);
-            NetworkReplicator::SpawnObject(controllerScript, controllerTargets);
-            NetworkReplicator::SetObjectOwnership(controllerActor, client->ClientId, NetworkObjectRole::ReplicatedSimulated, true);
-        }
-        else
-        {
-            const uint32 controllerTargetsData[1] = { NetworkManager::LocalClientId };
-            const DataContainer<uint32> controllerTargets(controllerTargetsData, ARRAY_COUNT(controllerTargetsData));
-            // TODO: support inheritance of targetClientIds for spawned objects so if we set it for controller actor, all attached scripts to it will inherit that too
-            NetworkReplicator::SpawnObject(controllerActor, controllerTargets);
-            NetworkReplicator::SpawnObject(controllerScript, controllerTargets);
-            NetworkReplicator::SetObjectOwnership(controllerActor, client->ClientId, NetworkObjectRole::OwnedAuthoritative, true);
-        }
-    }
-    else
-    {
-        // Offline mode requires some manual setup (no events from replication system)
-        _playersToSpawn.AddUnique(playerState->PlayerId);
+        // Whole controller hierarchy (actor, scripts and children) inherits target clients and ownership
+        const bool isRemote = NetworkManager::LocalClientId != playerState->NetworkClientId;
+        const uint32 controllerTargetsData[2] = { NetworkManager::LocalClientId, playerState->NetworkClientId };
+        const DataContainer<uint32> controllerTargets(controllerTargetsData, isRemote ? 2 : 1);
+        Utilities::SpawnNetworkActorTree(controllerActor, controllerTargets);
+        NetworkReplicator::SetObjectOwnership(controllerActor, client->ClientId, isRemote ? NetworkObjectRole::ReplicatedSimulated : NetworkObjectRole::OwnedAuthoritative, true);
     }
-    if (canSpawn)
-        Level::SpawnActor(controllerActor);
-    else
-        _sceneTransitionActors.Add(controllerActor);
+    SpawnPlayerActor(controllerActor);
 
-    _gameMode->OnPlayerJoined(playerState);
-    if (canSpawn)
-        _gameMode->OnPlayerSpawned(playerState);
-    else
-        _sceneTransitionPlayers.Add(playerState);
+    // Replicate player state with references to the pawn and controller (state was spawned before they got assigned)
+    NetworkReplicator::DirtyObject(playerState);
+
+    // Pawn and controller are ready (no need to wait for replication)
+    UpdatePlayerSpawn(playerState->PlayerId);
 
     return playerState;
 }
+
+void GameInstance::OnPlayersJoined(const Array<PlayerState*>& playerStates)
+{
+    _gameMode->OnPlayersJoined(playerStates);
+    const bool canSpawn = Level::Scenes.HasItems();
+    for (PlayerState* playerState : playerStates)
+    {
+        if (canSpawn)
+            _gameMode->OnPlayerSpawned(playerState);
+        else
+            _sceneTransitionPlayers.Add(playerState);
+    }
+}
@@ -3,10 +3,14 @@
 #pragma once
 
 #include "Engine/Scripting/Plugins/GamePlugin.h"
-#include "Types.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Content/AssetReference.h"
+#include "GameSystem.h"
+#include "GameSceneSystem.h"
 
 class Scene;
 class Actor;
+class Prefab;
 class NetworkClient;
 
 /// <summary>
@@ -14,23 +18,74 @@ class NetworkClient;
 /// </summary>
 API_CLASS() class ARIZONAFRAMEWORK_API GameInstance : public GamePlugin
 {
+    friend GameState;
+    friend PlayerState;
     friend PlayerPawn;
     friend PlayerController;
+    friend class GameInstanceSettings;
     DECLARE_SCRIPTING_TYPE(GameInstance);
 
 private:
+    // Parts of the player that need to be ready before spawning it on a level (used as flags).
+    enum SpawnParts : uint8
+    {
+        SpawnState = 1,
+        SpawnPawn = 2,
+        SpawnController = 4,
+        SpawnScene = 8,
+    };
+
+    // Group of systems that can be ticked or initialized together (no data access conflicts or dependencies between them).
+    struct TickWave
+    {
+        Array<GameSystem*> WorkerThread;
+        Array<GameSystem*> MainThread;
+    };
+
+    // Prefab instances created upfront to be reused by players.
+    struct ActorPool
+    {
+        AssetReference<Prefab> Asset;
+        Array<Actor*> Actors;
+        int32 Size = 0;
+    };
+
     Array<GameSystem*> _systems;
+    Dictionary<ScriptingTypeHandle, GameSystem*> _systemsCache;
+    static uint32 _systemsVersion;
+    Array<TickWave> _tickWaves[4];
+    bool _tickWavesDirty = true;
+    uint32 _tickWavesHash = 0;
+    GameSystemTickPhases _tickPhase;
+    const TickWave* _tickWave = nullptr;
+    const TickWave* _initWave = nullptr;
     Array<ScriptingTypeHandle> _sceneSystemTypes;
+    Array<SceneSystemFilter> _sceneSystemFilters;
+    static bool _sceneSystemFiltersDirty;
+    int32 _sceneSystemsCreated = 0;
+    int32 _sceneSystemsUsed = 0;
+    Dictionary<Scene*, Array<GameSceneSystem*>> _sceneSystems;
+    Array<GameSceneSystem*> _pendingSceneSystems;
+    // Scene systems that depend on other systems of the same scene (initialized in dependency order once scene gets loaded).
+    Array<GameSceneSystem*> _deferredSceneSystems;
+    // Game systems lookup for scene systems initialized on worker threads (resolved upfront from their InitializeDependencies).
+    Dictionary<ScriptingTypeHandle, GameSystem*> _pendingSceneDependencies;
+    Scene* _pendingScene = nullptr;
+    int64 _pendingSceneLabel = 0;
     bool _gameStarted = false;
     bool _isHosting = false;
     GameMode* _gameMode = nullptr;
     GameState* _gameState = nullptr;
-    Array<uint32, InlinedAllocation<8>> _playersToSpawn;
+    Dictionary<uint32, uint8> _playersToSpawn; // PlayerId -> missing SpawnParts
+    Array<uint32, InlinedAllocation<8>> _playersReadyToSpawn;
 #if !BUILD_RELEASE
     String _windowTitle;
 #endif
+    Actor* _playersRoot = nullptr;
     Array<Actor*> _sceneTransitionActors;
     Array<PlayerState*> _sceneTransitionPlayers;
+    Array<NetworkClient*> _clientsToJoin;
+    Dictionary<Guid, ActorPool> _actorPools;
 
 public:
     /// <summary>
@@ -46,6 +101,35 @@ public:
         return _systems;
     }
 
+    /// <summary>
+    /// Gets the amount of scene systems created for the last loaded scene (spawned after passing the scene system filters).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE int32 GetSceneSystemsCreated() const
+    {
+        return _sceneSystemsCreated;
+    }
+
+    /// <summary>
+    /// Gets the amount of scene systems used for the last loaded scene (created and accepted by CanBeUsed).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE int32 GetSceneSystemsUsed() const
+    {
+        return _sceneSystemsUsed;
+    }
+
+    /// <summary>
+    /// Sets the filter for the scene system type (overrides the filter from Game Instance Settings). Evaluated before spawning the system for the loading scene.
+    /// </summary>
+    /// <param name="type">The scene system type.</param>
+    /// <param name="filter">The filter.</param>
+    API_FUNCTION() static void SetSceneSystemFilter(const ScriptingTypeHandle& type, const SceneSystemFilter& filter);
+
+    /// <summary>
+    /// Removes the filter for the scene system type set with SetSceneSystemFilter (filter from Game Instance Settings is used again).
+    /// </summary>
+    /// <param name="type">The scene system type.</param>
+    API_FUNCTION() static void RemoveSceneSystemFilter(const ScriptingTypeHandle& type);
+
     /// <summary>
     /// Gets the game system of the given type.
     /// </summary>
@@ -69,6 +153,23 @@ public:
         return (T*)GetGameSystem(T::TypeInitializer);
     }
 
+    /// <summary>
+    /// Gets the game system of the given type from the game instance singleton. The result is cached until the list of the game systems changes so it's cheap to call it frequently. Can be used only on the main thread (cache is not thread-safe), use GetGameSystem within worker thread tick or initialization.
+    /// </summary>
+    template<typename T>
+    static T* GetCachedGameSystem()
+    {
+        static T* cached = nullptr;
+        static uint32 cachedVersion = 0;
+        if (cachedVersion != _systemsVersion)
+        {
+            const auto instance = GetInstance();
+            cached = instance ? instance->GetGameSystem<T>() : nullptr;
+            cachedVersion = _systemsVersion;
+        }
+        return cached;
+    }
+
 public:
     /// <summary>
     /// Event called when game starts.
@@ -117,6 +218,14 @@ public:
         return _gameState;
     }
 
+    /// <summary>
+    /// Gets the persistent root actor for player actors (pawns, controllers and UI). Null if UsePlayersRoot is disabled in Game Instance Settings or game is not started.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE Actor* GetPlayersRoot() const
+    {
+        return _playersRoot;
+    }
+
     /// <summary>
     /// Gets the local player state (null on server). Returns the first local player in case of local coop.
     /// </summary>
@@ -144,11 +253,36 @@ public:
     /// <returns>The newly added player.</returns>
     API_FUNCTION() PlayerState* SpawnLocalPlayer();
 
+public:
+    /// <summary>
+    /// Spawns the prefab instance. Uses the instance from the pool if available (see pool sizes in Game Instance Settings).
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <returns>The prefab instance (not added to the level).</returns>
+    API_FUNCTION() Actor* SpawnPooledPrefab(Prefab* prefab);
+
+    /// <summary>
+    /// Releases the prefab instance spawned with SpawnPooledPrefab. Unlinks it from level and returns to the pool if possible (otherwise actor gets deleted). Network-replicated actors cannot be reused thus are despawned.
+    /// </summary>
+    /// <param name="actor">The actor to release.</param>
+    API_FUNCTION() void ReleasePooledActor(Actor* actor);
+
 private:
     // [GamePlugin]
     void Initialize() override;
     void Deinitialize() override;
 
+    void OnSystemsChanged();
+    void BuildTickWaves();
+    void TickSystems(GameSystemTickPhases phase);
+    void TickSystemJob(int32 index);
+    void InitializeSystems(Array<GameSystem*>& systems);
+    void InitializeSystemJob(int32 index);
+    static void InitializeSystem(GameSystem* system);
+    void InitializeSceneSystemJob(int32 index);
+    void FinishSceneSystems();
+    void OnScriptingUpdate();
+    void OnScriptingLateUpdate();
     void OnUpdate();
     void OnNetworkStateChanged();
     void OnNetworkClientConnected(NetworkClient* client);
@@ -157,5 +291,17 @@ private:
     void OnSceneLoaded(Scene* scene, const Guid& sceneId);
     void OnSceneUnloading(Scene* scene, const Guid& sceneId);
     void OnSceneUnloaded(Scene* scene, const Guid& sceneId);
+    void ProcessClientsToJoin();
     PlayerState* CreatePlayer(NetworkClient* client);
+    void OnPlayersJoined(const Array<PlayerState*>& playerStates);
+    void SpawnPlayer(PlayerState* playerState);
+    void SpawnPlayerActor(Actor* actor);
+    uint8 GetPlayerSpawnMissingParts(uint32 playerId, PlayerState*& playerState) const;
+    void QueuePlayerSpawn(uint32 playerId);
+    void UpdatePlayerSpawn(uint32 playerId);
+    void UpdatePlayerSpawns(uint8 parts);
+    void CancelPlayerSpawn(uint32 playerId);
+    void WarmActorPool(Prefab* prefab, int32 size);
+    void UpdateActorPools();
+    void ClearActorPools();
 };
@@ -7,6 +7,8 @@
 #include "Engine/Scripting/SoftTypeReference.h"
 #include "Engine/Level/Prefabs/Prefab.h"
 #include "../Networking/ReplicationSettings.h"
+#include "../Networking/MovementEncoding.h"
+#include "GameSceneSystem.h"
 
 class NetworkReplicationHierarchy;
 
@@ -56,6 +58,76 @@ public:
     API_FIELD(Attributes="EditorOrder(160), EditorDisplay(\"Types\")")
     SoftAssetReference<Prefab> PlayerUIPrefab;
 
+public:
+    /// <summary>
+    /// The maximum amount of players to spawn on a level within a single frame (when their pawn and controller are ready). Limits hitches when many players join at once. Use 0 for unlimited.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(200), EditorDisplay(\"Players\"), Limit(0)")
+    int32 MaxPlayerSpawnsPerFrame = 4;
+
+    /// <summary>
+    /// The time budget (in milliseconds) for processing newly connected clients within a single frame (on host/server). Joining players over the budget are processed in the next frames. At least one player is processed each frame. Use 0 for unlimited.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(210), EditorDisplay(\"Players\"), Limit(0)")
+    float PlayerJoinTimeBudget = 2.0f;
+
+    /// <summary>
+    /// If checked, player actors (pawns, controllers and UI) are spawned under a single persistent root actor that is moved as a whole to the new level during scene transitions (instead of unlinking and relinking each player actor).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(220), EditorDisplay(\"Players\")")
+    bool UsePlayersRoot = true;
+
+public:
+    /// <summary>
+    /// The amount of Player Pawn prefab instances to create when game starts (on host/server) and keep ready for joining players. Use 0 to disable pooling.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(300), EditorDisplay(\"Pooling\"), Limit(0)")
+    int32 PlayerPawnPoolSize = 0;
+
+    /// <summary>
+    /// The amount of Player Controller prefab instances to create when game starts (on host/server) and keep ready for joining players. Use 0 to disable pooling.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(310), EditorDisplay(\"Pooling\"), Limit(0)")
+    int32 PlayerControllerPoolSize = 0;
+
+    /// <summary>
+    /// The amount of Player UI prefab instances to create when game starts (on host/client) and keep ready for local players. Use 0 to disable pooling.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(320), EditorDisplay(\"Pooling\"), Limit(0)")
+    int32 PlayerUIPoolSize = 0;
+
+public:
+    /// <summary>
+    /// Per-type scene system filters. Evaluated before spawning the scene system for the loading scene (systems are created only for matching scenes). Filters registered from code have priority.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(350), EditorDisplay(\"Scene Systems\")")
+    Dictionary<SoftTypeReference<GameSceneSystem>, SceneSystemFilter> SceneSystemFilters;
+
+public:
+    /// <summary>
+    /// The encoding of the pawn movement sent by clients to the server. Compact encoding reduces the upstream bandwidth at the cost of small quantization error (corrected over the next updates).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(400), EditorDisplay(\"Movement\")")
+    PawnMovementEncoding MovementEncoding = PawnMovementEncoding::Full;
+
+    /// <summary>
+    /// The precision (in world units) of the pawn movement translation for Compact encoding. Movement deltas larger than 32767 steps within a single network update are sent with full precision.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(410), EditorDisplay(\"Movement\"), Limit(0.0001f)")
+    float MovementPrecision = 0.1f;
+
+    /// <summary>
+    /// The maximum distance (in world units) between the pawn location predicted by the client and the one acknowledged by the server before the client gets corrected (moved to the server location and unacknowledged movement is replayed). Should be larger than the movement precision.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(420), EditorDisplay(\"Movement\"), Limit(0)")
+    float MovementCorrectionThreshold = 1.0f;
+
+    /// <summary>
+    /// The maximum amount of movement updates sent by client that wait for the server acknowledgement. Older moves are dropped when the buffer is full (eg. due to high latency or packet loss).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(430), EditorDisplay(\"Movement\"), Limit(1)")
+    int32 MovementPredictionBufferSize = 64;
+
 public:
     /// <summary>
     /// Type of the network replication hierarchy system to use.
@@ -69,9 +141,31 @@ public:
     API_FIELD(Attributes="EditorOrder(1010), EditorDisplay(\"Replication\")")
     ReplicationSettings DefaultReplicationSettings;
 
+    /// <summary>
+    /// The maximum amount of bytes (estimated from replication settings) of moving objects to replicate to a single client within a network update. Objects are sent by priority and the ones over budget are delayed to the next updates. Use 0 for unlimited.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1020), EditorDisplay(\"Replication\"), Limit(0)")
+    int32 ReplicationBudgetPerClient = 0;
+
+    /// <summary>
+    /// Adaptive replication settings. Used to automatically reduce replication rate (globally and per-client) during server frame time spikes or when clients receive too much data.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1030), EditorDisplay(\"Replication\")")
+    AdaptiveReplicationSettings AdaptiveReplication;
+
+    /// <summary>
+    /// The keep-alive replication rate (updates per second) of Game State and Player State objects. These are replicated when changed (via NetworkReplicator.DirtyObject) and to newly joined clients, the keep-alive only recovers from lost packets. Can be overridden with per-type replication settings.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1040), EditorDisplay(\"Replication\"), Limit(0)")
+    float StateReplicationFPS = 1.0f;
+
     /// <summary>
     /// Per-type replication settings. Runtime lookup includes base classes (but not interfaces).
     /// </summary>
     API_FIELD(Attributes="EditorOrder(1050), EditorDisplay(\"Replication\")")
     Dictionary<SoftTypeReference<>, ReplicationSettings> ReplicationSettingsPerType;
+
+public:
+    // [SettingsBase]
+    void Apply() override;
 };
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Types.h"
 
@@ -46,6 +47,12 @@ public:
     /// <param name="playerState">The player state.</param>
     API_FUNCTION() virtual void OnPlayerJoined(PlayerState* playerState);
 
+    /// <summary>
+    /// Called when a batch of players joins the game (eg. multiple clients connected at once). Default implementation calls OnPlayerJoined for each player.
+    /// </summary>
+    /// <param name="playerStates">The player states (in the order of joining).</param>
+    API_FUNCTION() virtual void OnPlayersJoined(const Array<PlayerState*>& playerStates);
+
     /// <summary>
     /// Called when player leaves the game (eg. disconnected). Despawns player pawn and controller.
     /// </summary>
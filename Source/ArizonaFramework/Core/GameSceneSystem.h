@@ -3,11 +3,51 @@
 #pragma once
 
 #include "GameSystem.h"
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Types/Guid.h"
 
 class Scene;
 
 /// <summary>
-/// Scene gameplay component attached to the Game Instance. Lifetime tied with the scene (multiple systems can exists, one for each loaded scene).
+/// Scene system creation filter. Evaluated before spawning the system for the loading scene to skip creating systems that are not used within it.
+/// </summary>
+API_STRUCT() struct ARIZONAFRAMEWORK_API SceneSystemFilter : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(SceneSystemFilter);
+
+    /// <summary>
+    /// The scene asset identifiers for which the system is created. Use empty to create it for all scenes.
+    /// </summary>
+    API_FIELD() Array<Guid> Scenes;
+
+    /// <summary>
+    /// The scene asset identifiers for which the system is not created.
+    /// </summary>
+    API_FIELD() Array<Guid> ExcludedScenes;
+
+    /// <summary>
+    /// The custom predicate (code-only) that checks if the system should be created for the scene. Called on main thread with the scene object that is not yet deserialized.
+    /// </summary>
+    Function<bool(Scene*, const Guid&)> Predicate;
+
+public:
+    /// <summary>
+    /// Checks if the system should be created for the scene.
+    /// </summary>
+    bool Check(Scene* scene, const Guid& sceneId) const
+    {
+        if (Scenes.HasItems() && !Scenes.Contains(sceneId))
+            return false;
+        if (ExcludedScenes.Contains(sceneId))
+            return false;
+        return !Predicate.IsBinded() || Predicate(scene, sceneId);
+    }
+};
+
+/// <summary>
+/// Scene gameplay component attached to the Game Instance. Lifetime tied with the scene (multiple systems can exists, one for each loaded scene). Systems with InitializeThreadSafe set are initialized on a job system while the scene is being loaded and get registered in the Game Instance (eg. for ticking) once the scene is loaded. Systems that depend on other systems of the same scene (via InitializeDependencies) are initialized on the main thread once the scene is loaded.
 /// </summary>
 API_CLASS(Abstract) class ARIZONAFRAMEWORK_API GameSceneSystem : public GameSystem
 {
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 #include "Types.h"
@@ -13,6 +14,13 @@
 API_CLASS() class ARIZONAFRAMEWORK_API GameState : public ScriptingObject
 {
     DECLARE_SCRIPTING_TYPE(GameState);
+    friend GameInstance;
+    friend PlayerState;
+
+private:
+    // Lookup indices for PlayerStates (kept in sync on player join/leave and replication).
+    Dictionary<uint32, PlayerState*> _playersById;
+    Dictionary<uint32, Array<PlayerState*, InlinedAllocation<4>>> _playersByClientId;
 
 public:
     /// <summary>
@@ -21,9 +29,9 @@ public:
     API_FIELD(NetworkReplicated, ReadOnly) uint32 NextPlayerId = 0;
 
     /// <summary>
-    /// List with all connected players state.
+    /// List with all connected players state. Not replicated as a whole - clients add and remove entries when Player State objects get spawned or despawned over the network.
     /// </summary>
-    API_FIELD(NetworkReplicated, ReadOnly) Array<ScriptingObjectReference<PlayerState>> PlayerStates;
+    API_FIELD(ReadOnly) Array<ScriptingObjectReference<PlayerState>> PlayerStates;
 
 public:
     /// <summary>
@@ -35,4 +43,16 @@ public:
     /// Gets the player state for a given unique PlayerId.
     /// </summary>
     API_FUNCTION() PlayerState* GetPlayerStateByPlayerId(uint32 playerId) const;
+
+    /// <summary>
+    /// Gets all the player states for a given unique NetworkClientId (multiple players in case of local coop).
+    /// </summary>
+    API_FUNCTION() Array<PlayerState*, InlinedAllocation<8>> GetPlayerStatesByNetworkClientId(uint32 networkClientId) const;
+
+private:
+    void AddPlayerState(PlayerState* playerState);
+    void RemovePlayerState(PlayerState* playerState);
+    void UpdatePlayerStateIndex(PlayerState* playerState);
+    void AddToIndex(PlayerState* playerState);
+    void RemoveFromIndex(PlayerState* playerState);
 };
@@ -2,9 +2,43 @@
 
 #pragma once
 
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Types.h"
 
+/// <summary>
+/// Frame update phases in which game systems can be ticked by the Game Instance.
+/// </summary>
+API_ENUM(Attributes="Flags") enum class GameSystemTickPhases
+{
+    /// <summary>
+    /// System is not ticked.
+    /// </summary>
+    None = 0,
+
+    /// <summary>
+    /// Beginning of the frame, before local players input processing and any gameplay logic updates.
+    /// </summary>
+    PreInput = 1 << 0,
+
+    /// <summary>
+    /// Scripting update (together with the scripts Update).
+    /// </summary>
+    Update = 1 << 1,
+
+    /// <summary>
+    /// Scripting late update (together with the scripts LateUpdate).
+    /// </summary>
+    LateUpdate = 1 << 2,
+
+    /// <summary>
+    /// End of the frame gameplay logic, before network replication of the objects.
+    /// </summary>
+    PreNetwork = 1 << 3,
+};
+
+DECLARE_ENUM_OPERATORS(GameSystemTickPhases);
+
 /// <summary>
 /// Gameplay system component attached to the Game Instance. Lifetime tied  with the game.
 /// </summary>
@@ -16,6 +50,37 @@ API_CLASS(Abstract) class ARIZONAFRAMEWORK_API GameSystem : public ScriptingObje
 private:
     GameInstance* _instance = nullptr;
 
+public:
+    /// <summary>
+    /// The frame phases in which the system gets ticked by the Game Instance (see OnTick). Can be set in constructor or within Initialize. Changes to the tick setup (phases, thread-safety, reads and writes) are applied at the beginning of the next frame.
+    /// </summary>
+    API_FIELD() GameSystemTickPhases TickPhases = GameSystemTickPhases::None;
+
+    /// <summary>
+    /// True if the system tick can be executed on a worker thread (in parallel with other systems that don't access the same data). Such system can get only the game systems listed in TickReads or TickWrites (other lookups return null when running on a worker thread).
+    /// </summary>
+    API_FIELD() bool TickThreadSafe = false;
+
+    /// <summary>
+    /// The types of data (eg. other game systems or gameplay objects) that the system reads during tick. Systems that write to them are ticked before this system.
+    /// </summary>
+    API_FIELD() Array<ScriptingTypeHandle> TickReads;
+
+    /// <summary>
+    /// The types of data (eg. other game systems or gameplay objects) that the system writes during tick. System always writes to its own type.
+    /// </summary>
+    API_FIELD() Array<ScriptingTypeHandle> TickWrites;
+
+    /// <summary>
+    /// True if the system Initialize can be executed on a worker thread (in parallel with other systems that don't depend on each other). Such system can access only the game systems listed in InitializeDependencies (other lookups return null when running on a worker thread). Systems without it are initialized on the main thread in the original order and see all the previous systems initialized. Should be set in constructor.
+    /// </summary>
+    API_FIELD() bool InitializeThreadSafe = false;
+
+    /// <summary>
+    /// The types of game systems that need to be initialized before this system (eg. to access them via GetGameSystem within Initialize). Should be set in constructor.
+    /// </summary>
+    API_FIELD() Array<ScriptingTypeHandle> InitializeDependencies;
+
 public:
     /// <summary>
     /// Gets the game instance that owns this system.
@@ -34,7 +99,7 @@ public:
     }
 
     /// <summary>
-    /// Initialization method for the system. Can be used to allocate resource and setup event handlers.
+    /// Initialization method for the system. Can be used to allocate resource and setup event handlers. Can be called from worker thread if InitializeThreadSafe is set.
     /// </summary>
     API_FUNCTION() virtual void Initialize()
     {
@@ -46,4 +111,12 @@ public:
     API_FUNCTION() virtual void Deinitialize()
     {
     }
+
+    /// <summary>
+    /// Update method for the system called for each of the TickPhases. Can be called from worker thread if TickThreadSafe is set.
+    /// </summary>
+    /// <param name="phase">The current update phase.</param>
+    API_FUNCTION() virtual void OnTick(GameSystemTickPhases phase)
+    {
+    }
 };
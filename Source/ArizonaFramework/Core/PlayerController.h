@@ -3,6 +3,9 @@
 #pragma once
 
 #include "Engine/Scripting/Script.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
 #include "Types.h"
 
 /// <summary>
@@ -19,6 +22,26 @@ protected:
     PlayerState* _playerState = nullptr;
     bool _spawned = false;
 
+private:
+    // Pawn movement accumulated on a client during the network tick to be sent to the server in a single RPC (includes quantization error left from the previous compact RPC).
+    Vector3 _moveTranslation = Vector3::Zero;
+    Quaternion _moveRotation = Quaternion::Identity;
+    bool _hasMove = false;
+    double _moveSendTime = 0.0;
+    // Sequence number of the last movement sent (on client) or applied (on server).
+    uint32 _moveSequence = 0;
+
+    // Movement sent to the server that is not yet acknowledged (on client), with the pawn location predicted after it.
+    struct PendingMove
+    {
+        uint32 Sequence;
+        Vector3 Translation;
+        Quaternion Rotation;
+        Vector3 Position;
+        Quaternion Orientation;
+    };
+    Array<PendingMove> _pendingMoves;
+
 public:
     /// <summary>
     /// Gets the player state for this controller.
@@ -54,15 +77,22 @@ public:
     }
 
     /// <summary>
-    /// Event called after receiving pawn movement from the client. Can be used to reject too big deltas that prevent players from cheating. Called on server-only.
+    /// Event called after receiving pawn movement from the client. Can be used to reject too big deltas that prevent players from cheating (client gets corrected to the server location). Called on server-only.
+    /// The client merges all MovePawn calls made since the last network update into a single delta (translations summed and rotations combined), so the limits should be based on the time between the client updates rather than on a single frame. With compact movement encoding, the delta is quantized and can include the quantization error left from the previous update.
     /// </summary>
-    /// <param name="translation">The translation vector.</param>
-    /// <param name="rotation">The rotation quaternion.</param>
+    /// <param name="translation">The merged translation vector.</param>
+    /// <param name="rotation">The merged rotation quaternion.</param>
     API_FUNCTION() virtual bool OnValidateMove(const Vector3& translation, const Quaternion& rotation)
     {
         return true;
     }
 
+    /// <summary>
+    /// Gets the locations used to evaluate network relevancy of objects for this player (eg. pawn location or spectator camera). Objects are relevant if they're in range of any viewpoint of any player from the client. Called on server-only.
+    /// </summary>
+    /// <param name="viewpoints">The output list to add viewpoints to. Default implementation adds the player pawn location.</param>
+    API_FUNCTION() virtual void GetRelevancyViewpoints(API_PARAM(Ref) Array<Vector3>& viewpoints) const;
+
 public:
     /// <summary>
     /// Creates the Player UI actor for a player which will be used by the local player.
@@ -72,7 +102,7 @@ public:
     API_FUNCTION() virtual Actor* CreatePlayerUI(PlayerState* playerState);
 
     /// <summary>
-    /// Moves pawn (on both local client and server).
+    /// Moves pawn (on both local client and server). Client movement is applied locally and accumulated to be sent to the server once per network update.
     /// </summary>
     /// <param name="translation">The translation vector.</param>
     /// <param name="rotation">The rotation quaternion.</param>
@@ -83,7 +113,13 @@ protected:
     virtual void OnMovePawn(Actor* pawnActor, const Vector3& translation, const Quaternion& rotation);
 
 private:
-    API_FUNCTION(NetworkRpc=Server) void MovePawnServer(const Vector3& translation, const Quaternion& rotation);
+    API_FUNCTION(NetworkRpc=Server) void MovePawnServer(uint32 sequence, const Vector3& translation, const Quaternion& rotation);
+    API_FUNCTION(NetworkRpc=Server) void MovePawnServerCompact(uint32 sequence, int16 translationX, int16 translationY, int16 translationZ, uint32 rotation);
+    void ApplyMoveServer(uint32 sequence, const Vector3& translation, const Quaternion& rotation);
+    API_FUNCTION(NetworkRpc="Client, UnreliableOrdered") void MovePawnAck(uint32 sequence, const Vector3& position, const Quaternion& orientation);
+    void AddPendingMove(const Vector3& translation, const Quaternion& rotation);
+    void SendMoves(bool flush = false);
+    void Despawn();
 
 public:
     // [Script]
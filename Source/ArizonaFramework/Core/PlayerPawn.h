@@ -18,6 +18,10 @@ protected:
     PlayerState* _playerState = nullptr;
     uint32 _playerId = MAX_uint32;
     bool _spawned = false;
+    // True if the pawn script was spawned for network replication (reset when the actor gets released to the pool).
+    bool _networkSpawned = false;
+    // True if the pawn was started and then released to the pool (needs to be spawned for network replication again when reused).
+    bool _released = false;
 
 public:
     /// <summary>
@@ -47,6 +51,8 @@ public:
 private:
     API_PROPERTY(NetworkReplicated) void SetPlayerState(PlayerState* value);
     API_PROPERTY(NetworkReplicated) void SetPlayerId(uint32 value);
+    void Despawn();
+    void SpawnNetwork();
 
 public:
     // [Script]
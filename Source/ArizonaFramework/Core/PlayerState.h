@@ -3,14 +3,21 @@
 #pragma once
 
 #include "Engine/Scripting/ScriptingObject.h"
+#include "Engine/Networking/INetworkObject.h"
 #include "Types.h"
 
 /// <summary>
 /// Player gameplay state container.
 /// </summary>
-API_CLASS() class ARIZONAFRAMEWORK_API PlayerState : public ScriptingObject
+API_CLASS() class ARIZONAFRAMEWORK_API PlayerState : public ScriptingObject, public INetworkObject
 {
     DECLARE_SCRIPTING_TYPE(PlayerState);
+    friend GameState;
+
+private:
+    // Identifiers under which this player is registered in the Game State lookup index.
+    uint32 _indexedNetworkClientId = MAX_uint32;
+    uint32 _indexedPlayerId = MAX_uint32;
 
 public:
     /// <summary>
@@ -37,4 +44,13 @@ public:
     /// Player UI script (attached to the player UI actor). Created only on local player client. Not replicated.
     /// </summary>
     API_FIELD(ReadOnly) PlayerUI* PlayerUI = nullptr;
+
+public:
+    // [ScriptingObject]
+    void OnDeleteObject() override;
+
+    // [INetworkObject]
+    void OnNetworkDeserialize() override;
+    void OnNetworkSpawn() override;
+    void OnNetworkDespawn() override;
 };
@@ -36,6 +36,7 @@ public:
 
 private:
     API_PROPERTY(NetworkReplicated) void SetPlayerState(PlayerState* value);
+    void Despawn();
 
 public:
     // [Script]
@@ -29,6 +29,7 @@ DebugWindow::DebugWindow(const SpawnParams& params)
 DebugSystem::DebugSystem(const SpawnParams& params)
     : GameSystem(params)
 {
+    TickPhases = GameSystemTickPhases::Update;
 }
 
 void DebugSystem::SetActive(bool active)
@@ -47,17 +48,15 @@ void DebugSystem::SetActive(bool active)
 
 void DebugSystem::Initialize()
 {
-    Scripting::Update.Bind<DebugSystem, &DebugSystem::OnUpdate>(this);
     _menuActive = false;
 }
 
 void DebugSystem::Deinitialize()
 {
-    Scripting::Update.Unbind<DebugSystem, &DebugSystem::OnUpdate>(this);
     _windows.ClearDelete();
 }
 
-void DebugSystem::OnUpdate()
+void DebugSystem::OnTick(GameSystemTickPhases phase)
 {
     PROFILE_CPU();
     const auto& debugSettings = *DebugSettings::Get();
@@ -21,7 +21,5 @@ public:
     // [GameSystem]
     void Initialize() override;
     void Deinitialize() override;
-
-private:
-    void OnUpdate();
+    void OnTick(GameSystemTickPhases phase) override;
 };
@@ -6,6 +6,8 @@
 #include "Engine/Level/Level.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Utilities/StringConverter.h"
+#include "Engine/Networking/NetworkReplicator.h"
+#include "ArizonaFramework/Networking/ReplicationHierarchy.h"
 #include <ImGui/imgui.h>
 
 DebugGeneralToolsWindow::DebugGeneralToolsWindow(const SpawnParams& params)
@@ -292,6 +294,131 @@ int DebugGeneralConsoleWindow::OnTextEditCallback(ImGuiInputTextCallbackData* da
 
 #endif
 
+DebugNetworkReplicationWindow::DebugNetworkReplicationWindow(const SpawnParams& params)
+    : DebugWindow(params)
+{
+    MenuName = "Network/Replication";
+}
+
+void DebugNetworkReplicationWindow::OnActivated()
+{
+    ReplicationHierarchy::StatsEnabled = true;
+    _sentHistory.Clear();
+    _bytesHistory.Clear();
+    _timeHistory.Clear();
+}
+
+void DebugNetworkReplicationWindow::OnDeactivated()
+{
+    ReplicationHierarchy::StatsEnabled = false;
+}
+
+void DebugNetworkReplicationWindow::AddHistory(Array<float>& history, float value)
+{
+    constexpr int32 historySize = 120;
+    if (history.Count() == historySize)
+        history.RemoveAtKeepOrder(0);
+    history.Add(value);
+}
+
+void DebugNetworkReplicationWindow::OnDraw()
+{
+    if (!ImGui::Begin("Replication", &_active))
+        return;
+    const auto* hierarchy = ScriptingObject::Cast<ReplicationHierarchy>(NetworkReplicator::GetHierarchy());
+    if (!hierarchy)
+    {
+        ImGui::Text("No replication hierarchy in use.");
+        ImGui::End();
+        return;
+    }
+    const ReplicationStats& stats = hierarchy->GetStats();
+
+    // Rolling graphs (sampled once per replication update)
+    if (stats.Frame != _lastFrame)
+    {
+        _lastFrame = stats.Frame;
+        AddHistory(_sentHistory, (float)stats.Sent);
+        AddHistory(_bytesHistory, (float)stats.Bytes);
+        AddHistory(_timeHistory, stats.UpdateTime);
+    }
+    ImGui::Text("Considered: %d, Culled: %d, Sent: %d, Estimated Bytes: %d, Update: %.3f ms", stats.Considered, stats.Culled, stats.Sent, stats.Bytes, stats.UpdateTime);
+    ImGui::PlotLines("Sent", _sentHistory.Get(), _sentHistory.Count(), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 40));
+    ImGui::PlotLines("Estimated Bytes", _bytesHistory.Get(), _bytesHistory.Count(), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 40));
+    ImGui::PlotLines("Update (ms)", _timeHistory.Get(), _timeHistory.Count(), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 40));
+
+    // Per-type breakdown
+    if (ImGui::CollapsingHeader("Types", ImGuiTreeNodeFlags_DefaultOpen) && ImGui::BeginTable("Types", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Type");
+        ImGui::TableSetupColumn("Considered");
+        ImGui::TableSetupColumn("Sent");
+        ImGui::TableSetupColumn("Estimated Bytes");
+        ImGui::TableHeadersRow();
+        for (const auto& e : stats.Types)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(e.TypeName.Get());
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", e.Considered);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", e.Sent);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", e.Bytes);
+        }
+        ImGui::EndTable();
+    }
+
+    // Per-client breakdown
+    if (ImGui::CollapsingHeader("Clients") && ImGui::BeginTable("Clients", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Client");
+        ImGui::TableSetupColumn("Objects");
+        ImGui::TableSetupColumn("Estimated Bytes");
+        ImGui::TableHeadersRow();
+        for (int32 i = 0; i < stats.ClientBytes.Count(); i++)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", i);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", stats.ClientObjects[i]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", stats.ClientBytes[i]);
+        }
+        ImGui::EndTable();
+    }
+
+    // Per-cell breakdown
+    if (ImGui::CollapsingHeader("Cells") && ImGui::BeginTable("Cells", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Cell");
+        ImGui::TableSetupColumn("Group");
+        ImGui::TableSetupColumn("Objects");
+        ImGui::TableSetupColumn("Sent");
+        ImGui::TableHeadersRow();
+        for (const auto& e : stats.Cells)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%d, %d, %d", e.Coord.X, e.Coord.Y, e.Coord.Z);
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", e.Group);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", e.Objects);
+            ImGui::TableNextColumn();
+            if (e.Skipped)
+                ImGui::TextDisabled("skipped");
+            else
+                ImGui::Text("%d", e.Sent);
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
+
 DebugSceneTreeWindow::DebugSceneTreeWindow(const SpawnParams& params)
     : DebugWindow(params)
 {
@@ -43,6 +43,22 @@ private:
 
 #endif
 
+// Network replication statistics (objects and bandwidth per type, client and grid cell).
+API_CLASS(Namespace="ArizonaFramework.Debug") class ARIZONAFRAMEWORK_API DebugNetworkReplicationWindow : public DebugWindow
+{
+    DECLARE_SCRIPTING_TYPE(DebugNetworkReplicationWindow);
+    void OnDraw() override;
+    void OnActivated() override;
+    void OnDeactivated() override;
+private:
+    uint32 _lastFrame = 0;
+    Array<float> _sentHistory;
+    Array<float> _bytesHistory;
+    Array<float> _timeHistory;
+
+    static void AddHistory(Array<float>& history, float value);
+};
+
 // Scene hierarchy debugging window.
 API_CLASS(Namespace="ArizonaFramework.Debug") class ARIZONAFRAMEWORK_API DebugSceneTreeWindow : public DebugWindow
 {
@@ -0,0 +1,769 @@
+#include "DynamicReplicationGridNode.h"
+#include "ReplicationHierarchy.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Networking/NetworkClient.h"
+#include "Engine/Networking/NetworkManager.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+namespace
+{
+    // Cell coordinate of the objects without an actor (they have no location so they're not culled by distance, only by the interest group).
+    const Int3 NonSpatialCoord(MAX_int32, MAX_int32, MAX_int32);
+
+    void UnsetBits(NetworkClientsMask& mask, const NetworkClientsMask& bits, int32 clientsCount)
+    {
+        for (int32 i = 0; i < clientsCount; i++)
+        {
+            if (bits.HasBit(i))
+                mask.UnsetBit(i);
+        }
+    }
+
+    void IntersectBits(NetworkClientsMask& mask, const NetworkClientsMask& bits, int32 clientsCount)
+    {
+        for (int32 i = 0; i < clientsCount; i++)
+        {
+            if (!bits.HasBit(i))
+                mask.UnsetBit(i);
+        }
+    }
+
+    uint16 GetUpdatesInterval(float networkFPS, float replicationFPS)
+    {
+        return (uint16)Math::Clamp<int32>(Math::RoundToInt(networkFPS / replicationFPS) - 1, 0, MAX_uint16);
+    }
+}
+
+Int3 DynamicReplicationGridNode::GetCellCoord(const Vector3& position) const
+{
+    const Vector3 coord = position / CellSize;
+    return Int3((int32)Math::Floor(coord.X), (int32)Math::Floor(coord.Y), (int32)Math::Floor(coord.Z));
+}
+
+DynamicReplicationGridNode::CellKey DynamicReplicationGridNode::GetCellKey(const Item& item) const
+{
+    CellKey key;
+    key.Coord = NonSpatialCoord;
+    key.Group = item.Group;
+    if (const Actor* actor = item.Object.GetActor())
+        key.Coord = GetCellCoord(actor->GetPosition());
+    return key;
+}
+
+void DynamicReplicationGridNode::ApplySettings(Item& item)
+{
+    const ScriptingTypeHandle typeHandle = item.Object.Object->GetTypeHandle();
+    const ReplicationSettings settings = ReplicationHierarchy::GetSettings(typeHandle);
+    item.PriorityWeight = settings.PriorityWeight;
+    item.EstimatedSize = Math::Max(settings.EstimatedSize, 1);
+    item.LODs = -1;
+    if (settings.LODs.HasItems())
+    {
+        // Share levels of detail between objects of the same type
+        if (!_lodsPerType.TryGet(typeHandle, item.LODs))
+        {
+            item.LODs = _lods.Count();
+            auto& lods = _lods.AddOne();
+            for (const ReplicationLOD& e : settings.LODs)
+                lods.Add({ (Real)e.Distance * e.Distance, e.ReplicationFPS });
+            Sorting::QuickSort(lods.Get(), lods.Count());
+            _lodsPerType.Add(typeHandle, item.LODs);
+        }
+    }
+}
+
+void DynamicReplicationGridNode::UpdateSettings()
+{
+    PROFILE_CPU();
+    _settingsVersion = ReplicationHierarchy::GetSettingsVersion();
+
+    // Levels of detail are cached per-type so rebuild them for all objects (eg. after settings or scripts reload)
+    _lods.Clear();
+    _lodsPerType.Clear();
+    for (auto& e : _cells)
+    {
+        for (Item& item : e.Value.Items)
+            ApplySettings(item);
+    }
+    for (Item& item : _alwaysRelevant)
+        ApplySettings(item);
+}
+
+DynamicReplicationGridNode::Item* DynamicReplicationGridNode::FindItem(ScriptingObject* obj)
+{
+    CellKey key;
+    if (!_objectToCell.TryGet(obj, key))
+    {
+        for (Item& item : _alwaysRelevant)
+        {
+            if (item.Object.Object == obj)
+                return &item;
+        }
+        return nullptr;
+    }
+    Cell* cell = _cells.TryGet(key);
+    if (!cell)
+        return nullptr;
+    for (Item& item : cell->Items)
+    {
+        if (item.Object.Object == obj)
+            return &item;
+    }
+    return nullptr;
+}
+
+void DynamicReplicationGridNode::AddToCell(const CellKey& key, const Item& item)
+{
+    Cell* cell = _cells.TryGet(key);
+    if (!cell)
+    {
+        cell = &_cells[key];
+        cell->MinCullDistance = MAX_float;
+        cell->MaxCullDistance = 0.0f;
+        cell->CullDistanceDirty = false;
+    }
+    cell->Items.Add(item);
+    if (key.Coord != NonSpatialCoord)
+        cell->AddCullDistance(item.Object.CullDistance);
+    _objectToCell[item.Object.Object] = key;
+}
+
+void DynamicReplicationGridNode::AddObject(NetworkReplicationHierarchyObject obj)
+{
+    AddGroupObject(obj, 0);
+}
+
+void DynamicReplicationGridNode::AddGroupObject(const NetworkReplicationHierarchyObject& obj, uint32 group)
+{
+    if (_settingsVersion != ReplicationHierarchy::GetSettingsVersion())
+        UpdateSettings();
+    Item item;
+    item.Object = obj;
+    item.WaitingUpdates = 0;
+    item.SendCounter = 0;
+    item.Group = group;
+    ApplySettings(item);
+    if (obj.ReplicationFPS <= 0.0f)
+        _alwaysRelevant.Add(item);
+    else
+        AddToCell(GetCellKey(item), item);
+}
+
+bool DynamicReplicationGridNode::SetObjectGroup(ScriptingObject* obj, uint32 group)
+{
+    Item* item = FindItem(obj);
+    if (!item)
+        return false;
+    if (item->Group != group)
+    {
+        item->Group = group;
+        if (_objectToCell.ContainsKey(obj))
+            _movedObjects.Add(ToPair(obj, GetCellKey(*item)));
+    }
+    return true;
+}
+
+bool DynamicReplicationGridNode::RemoveObject(ScriptingObject* obj)
+{
+    CellKey key;
+    if (!_objectToCell.TryGet(obj, key))
+    {
+        for (int32 i = 0; i < _alwaysRelevant.Count(); i++)
+        {
+            if (_alwaysRelevant[i].Object.Object == obj)
+            {
+                _alwaysRelevant.RemoveAt(i);
+                return true;
+            }
+        }
+        return false;
+    }
+    _objectToCell.Remove(obj);
+    if (Cell* cell = _cells.TryGet(key))
+    {
+        for (int32 i = 0; i < cell->Items.Count(); i++)
+        {
+            if (cell->Items[i].Object.Object == obj)
+            {
+                cell->Items.RemoveAt(i);
+                cell->CullDistanceDirty = true;
+                break;
+            }
+        }
+        if (cell->Items.IsEmpty())
+            _cells.Remove(key);
+    }
+    return true;
+}
+
+bool DynamicReplicationGridNode::DirtyObject(ScriptingObject* obj)
+{
+    if (Item* item = FindItem(obj))
+    {
+        item->Object.ReplicationUpdatesLeft = 0;
+        return true;
+    }
+    return false;
+}
+
+void DynamicReplicationGridNode::UpdateCells()
+{
+    PROFILE_CPU();
+
+    // Move objects between cells (keeps replication state)
+    for (const auto& e : _movedObjects)
+    {
+        const Item* item = FindItem(e.First);
+        CellKey key;
+        if (!item || !_objectToCell.TryGet(e.First, key) || key == e.Second)
+            continue;
+        const Item moved = *item;
+        RemoveObject(e.First);
+        AddToCell(e.Second, moved);
+    }
+    _movedObjects.Clear();
+
+    // Refresh cull distance range of the cells that lost objects
+    for (auto& e : _cells)
+    {
+        Cell& cell = e.Value;
+        if (!cell.CullDistanceDirty)
+            continue;
+        cell.CullDistanceDirty = false;
+        if (e.Key.Coord == NonSpatialCoord)
+            continue;
+        cell.MinCullDistance = MAX_float;
+        cell.MaxCullDistance = 0.0f;
+        for (const Item& item : cell.Items)
+            cell.AddCullDistance(item.Object.CullDistance);
+    }
+}
+
+void DynamicReplicationGridNode::UpdateClients(int32 clientsCount)
+{
+    bool changed = _clientIds.Count() != clientsCount;
+    for (int32 i = 0; i < clientsCount && !changed; i++)
+        changed = _clientIds[i] != NetworkManager::Clients[i]->ClientId;
+    if (!changed)
+        return;
+    PROFILE_CPU();
+    _clientIds.Resize(clientsCount);
+    for (int32 i = 0; i < clientsCount; i++)
+        _clientIds[i] = NetworkManager::Clients[i]->ClientId;
+
+    // Per-client state is indexed by the client position which is not valid anymore
+    _clientAccumulators.Clear();
+    for (auto& e : _cells)
+    {
+        for (Item& item : e.Value.Items)
+        {
+            if (item.PendingClients)
+            {
+                item.PendingClients = NetworkClientsMask();
+                item.WaitingUpdates = 0;
+            }
+        }
+    }
+}
+
+void DynamicReplicationGridNode::SkipCell(const CellKey& key, Cell& cell, float networkFPS)
+{
+    // Objects out of range are not sent but get checked for moving to another cell at their replication rate
+    for (Item& item : cell.Items)
+    {
+        NetworkReplicationHierarchyObject& obj = item.Object;
+        if (obj.ReplicationUpdatesLeft > 0)
+        {
+            obj.ReplicationUpdatesLeft--;
+            continue;
+        }
+        obj.ReplicationUpdatesLeft = GetUpdatesInterval(networkFPS, obj.ReplicationFPS);
+        item.WaitingUpdates = 0;
+        if (const Actor* actor = obj.GetActor())
+        {
+            const Int3 coord = GetCellCoord(actor->GetPosition());
+            if (coord != key.Coord)
+                _movedObjects.Add(ToPair(obj.Object, CellKey{ coord, item.Group }));
+        }
+    }
+}
+
+void DynamicReplicationGridNode::Update(NetworkReplicationHierarchyUpdateResult* result)
+{
+    CHECK(result);
+    PROFILE_CPU();
+
+    if (_settingsVersion != ReplicationHierarchy::GetSettingsVersion())
+        UpdateSettings();
+    const int32 clientsCount = NetworkManager::Clients.Count();
+    UpdateClients(clientsCount);
+    GatherViewpoints(result, clientsCount);
+    const bool clientsHaveLocation = _clientIndices.HasItems();
+    const bool clientsWithoutLocation = _clientIndices.Count() != clientsCount;
+    const bool useBudget = BudgetPerClient > 0;
+    if (TrackClientStats)
+    {
+        _clientBytes.Resize(clientsCount);
+        _clientBytes.SetAll(0);
+        _clientQueueDepth.Resize(clientsCount);
+        _clientQueueDepth.SetAll(0);
+    }
+
+    // Find clients that receive updates this time (based on per-client replication scale)
+    NetworkClientsMask activeClients;
+    bool allClientsActive = true;
+    const int32 prevClientsCount = _clientAccumulators.Count();
+    _clientAccumulators.Resize(clientsCount);
+    for (int32 i = prevClientsCount; i < clientsCount; i++)
+        _clientAccumulators[i] = 0.0f;
+    for (int32 i = 0; i < clientsCount; i++)
+    {
+        float& accumulator = _clientAccumulators[i];
+        accumulator += i < ClientScales.Count() ? ClientScales[i] : 1.0f;
+        if (accumulator >= 1.0f)
+        {
+            accumulator = Math::Min(accumulator - 1.0f, 1.0f);
+            activeClients.SetBit(i);
+        }
+        else
+        {
+            allClientsActive = false;
+        }
+    }
+
+    // Always relevant objects skip the spatial culling
+    for (Item& item : _alwaysRelevant)
+    {
+        NetworkClientsMask targetClients = item.Object.TargetClients;
+        if (item.Group != 0)
+        {
+            const NetworkClientsMask* groupClients = GroupClients.TryGet(item.Group);
+            if (!groupClients || !*groupClients)
+                continue;
+            IntersectBits(targetClients, *groupClients, clientsCount);
+        }
+        result->AddObject(item.Object.Object, targetClients);
+        if (TrackClientStats)
+            AddClientBytes(targetClients, item.EstimatedSize, clientsCount);
+        if (Stats)
+        {
+            Stats->RecordConsidered(item.Object.Object->GetTypeHandle());
+            RecordSent(item, targetClients, clientsCount, -1);
+        }
+    }
+
+    const float networkFPS = NetworkManager::NetworkFPS / result->ReplicationScale;
+    const Real cellRadius = CellSize * 0.866f; // Half of the cell diagonal
+    for (auto& e : _cells)
+    {
+        Cell& cell = e.Value;
+        const bool spatial = e.Key.Coord != NonSpatialCoord;
+        const Vector3 cellCenter = (Vector3(e.Key.Coord) + 0.5f) * CellSize;
+        int32 cellStats = -1;
+        if (Stats)
+        {
+            cellStats = Stats->Cells.Count();
+            auto& stats = Stats->Cells.AddOne();
+            stats.Coord = e.Key.Coord;
+            stats.Group = e.Key.Group;
+            stats.Objects = cell.Items.Count();
+            stats.Sent = 0;
+            stats.Skipped = true;
+        }
+
+        // Skip the whole cell if none of the clients is subscribed to its interest group
+        const NetworkClientsMask* groupClients = nullptr;
+        if (e.Key.Group != 0)
+        {
+            groupClients = GroupClients.TryGet(e.Key.Group);
+            if (!groupClients || !*groupClients)
+            {
+                SkipCell(e.Key, cell, networkFPS);
+                continue;
+            }
+        }
+
+        // Find clients that are in range of the cell (inRange) and clients for which all objects in the cell pass culling (fullyInRange)
+        NetworkClientsMask inRange, fullyInRange;
+        bool anyInRange = !clientsHaveLocation || clientsWithoutLocation || !spatial;
+        bool allFullyInRange = true;
+        if (clientsHaveLocation && spatial)
+        {
+            ComputeClientDistances(cellCenter);
+            for (int32 i = 0; i < _clientIndices.Count(); i++)
+            {
+                if (groupClients && !groupClients->HasBit(_clientIndices[i]))
+                    continue;
+                const Real distance = Math::Sqrt(_clientDistanceSq[i]);
+                if (distance + cellRadius <= cell.MinCullDistance)
+                {
+                    inRange.SetBit(_clientIndices[i]);
+                    fullyInRange.SetBit(_clientIndices[i]);
+                    anyInRange = true;
+                }
+                else if (distance - cellRadius <= cell.MaxCullDistance)
+                {
+                    inRange.SetBit(_clientIndices[i]);
+                    allFullyInRange = false;
+                    anyInRange = true;
+                }
+            }
+        }
+        if (!anyInRange)
+        {
+            SkipCell(e.Key, cell, networkFPS);
+            continue;
+        }
+        if (Stats)
+            Stats->Cells[cellStats].Skipped = false;
+
+        for (Item& item : cell.Items)
+        {
+            NetworkReplicationHierarchyObject& obj = item.Object;
+            if (obj.ReplicationUpdatesLeft > 0)
+            {
+                // Move to the next frame
+                obj.ReplicationUpdatesLeft--;
+            }
+            else
+            {
+                if (Stats)
+                    Stats->RecordConsidered(item.Object.Object->GetTypeHandle());
+                NetworkClientsMask targetClients = obj.TargetClients;
+                if (groupClients)
+                    IntersectBits(targetClients, *groupClients, clientsCount);
+                const Actor* actor = obj.GetActor();
+                const Vector3 position = actor ? actor->GetPosition() : cellCenter;
+                if (actor)
+                {
+                    // Re-bucket objects that moved to another cell (applied after the update)
+                    const Int3 coord = GetCellCoord(position);
+                    if (coord != e.Key.Coord)
+                        _movedObjects.Add(ToPair(obj.Object, CellKey{ coord, item.Group }));
+                }
+                bool hasDistances = false;
+                if (clientsHaveLocation && spatial && obj.CullDistance > 0.0f)
+                {
+                    // Cull only against clients near the cell (distance check only for ones on the cell boundary)
+                    const Real cullDistanceSq = Math::Square(obj.CullDistance);
+                    if (!allFullyInRange)
+                    {
+                        ComputeClientDistances(position);
+                        hasDistances = true;
+                    }
+                    for (int32 i = 0; i < _clientIndices.Count(); i++)
+                    {
+                        const int32 clientIndex = _clientIndices[i];
+                        if (!targetClients.HasBit(clientIndex))
+                            continue;
+                        if (!inRange.HasBit(clientIndex))
+                            targetClients.UnsetBit(clientIndex);
+                        else if (!allFullyInRange && !fullyInRange.HasBit(clientIndex) && _clientDistanceSq[i] >= cullDistanceSq)
+                            targetClients.UnsetBit(clientIndex);
+                    }
+                }
+                if (item.LODs != -1 && clientsHaveLocation && spatial && targetClients && !item.PendingClients)
+                {
+                    if (!hasDistances)
+                        ComputeClientDistances(position);
+                    if (!ApplyLODs(item, targetClients))
+                    {
+                        // Skip update for all clients in this frame due to lower rate of levels of detail
+                        if (Stats)
+                            Stats->Culled++;
+                        item.WaitingUpdates = 0;
+                        obj.ReplicationUpdatesLeft = GetUpdatesInterval(networkFPS, obj.ReplicationFPS);
+                        continue;
+                    }
+                }
+                if (useBudget && targetClients)
+                {
+                    // Send only to clients that didn't receive this update yet (over budget in the previous updates)
+                    if (item.PendingClients)
+                    {
+                        for (int32 i = 0; i < clientsCount; i++)
+                        {
+                            if (!item.PendingClients.HasBit(i))
+                                targetClients.UnsetBit(i);
+                        }
+                    }
+                    item.PendingClients = targetClients;
+                    if (!allClientsActive)
+                    {
+                        // Skipped clients stay pending
+                        for (int32 i = 0; i < clientsCount; i++)
+                        {
+                            if (!activeClients.HasBit(i))
+                                targetClients.UnsetBit(i);
+                        }
+                        if (!targetClients && item.PendingClients)
+                        {
+                            if (item.WaitingUpdates < MAX_uint16)
+                                item.WaitingUpdates++;
+                            continue;
+                        }
+                    }
+                    if (targetClients)
+                    {
+                        auto& candidate = _candidates.AddOne();
+                        candidate.Entry = &item;
+                        candidate.Position = position;
+                        candidate.HasPosition = spatial;
+                        candidate.TargetClients = targetClients;
+                        candidate.SendClients = NetworkClientsMask();
+                        candidate.CellStats = cellStats;
+                        continue;
+                    }
+                }
+                if (!allClientsActive)
+                {
+                    // Skip clients with reduced replication scale
+                    for (int32 i = 0; i < clientsCount; i++)
+                    {
+                        if (!activeClients.HasBit(i))
+                            targetClients.UnsetBit(i);
+                    }
+                }
+                if (targetClients)
+                {
+                    result->AddObject(obj.Object, targetClients);
+                    if (TrackClientStats)
+                        AddClientBytes(targetClients, item.EstimatedSize, clientsCount);
+                    if (Stats)
+                        RecordSent(item, targetClients, clientsCount, cellStats);
+
+                    // Calculate frames until next replication
+                    obj.ReplicationUpdatesLeft = GetUpdatesInterval(networkFPS, obj.ReplicationFPS);
+                }
+                else if (Stats)
+                {
+                    Stats->Culled++;
+                }
+                item.WaitingUpdates = 0;
+            }
+        }
+    }
+
+    if (_candidates.HasItems())
+        SendCandidates(result, clientsCount);
+
+    // Apply cell changes after sending (candidates point to the cell items)
+    UpdateCells();
+}
+
+void DynamicReplicationGridNode::AddClientBytes(const NetworkClientsMask& clients, int32 size, int32 clientsCount)
+{
+    for (int32 i = 0; i < clientsCount; i++)
+    {
+        if (clients.HasBit(i))
+            _clientBytes[i] += size;
+    }
+}
+
+void DynamicReplicationGridNode::RecordSent(const Item& item, const NetworkClientsMask& clients, int32 clientsCount, int32 cellStats)
+{
+    Stats->RecordSent(item.Object.Object->GetTypeHandle(), item.EstimatedSize, clients, clientsCount);
+    if (cellStats != -1)
+        Stats->Cells[cellStats].Sent++;
+}
+
+void DynamicReplicationGridNode::GatherViewpoints(NetworkReplicationHierarchyUpdateResult* result, int32 clientsCount)
+{
+    _viewX.Clear();
+    _viewY.Clear();
+    _viewZ.Clear();
+    _clientIndices.Clear();
+    _clientViewStart.Clear();
+    _clientViewCount.Clear();
+    _clientSlots.Resize(clientsCount);
+    _clientSlots.SetAll(-1);
+    if (ClientViewpoints.HasItems())
+    {
+        // Use viewpoints provided by the hierarchy
+        for (int32 i = 0; i < ClientViewpoints.Count() && i < ClientViewpointIndices.Count(); i++)
+        {
+            const int32 clientIndex = ClientViewpointIndices[i];
+            if (clientIndex >= 0 && clientIndex < clientsCount)
+                AddViewpoint(clientIndex, ClientViewpoints[i]);
+        }
+    }
+    else
+    {
+        // Use a single location per-client
+        for (int32 i = 0; i < clientsCount; i++)
+        {
+            Vector3 location;
+            if (result->GetClientLocation(i, location))
+                AddViewpoint(i, location);
+        }
+    }
+    _viewDistanceSq.Resize(_viewX.Count());
+    _clientDistanceSq.Resize(_clientIndices.Count());
+}
+
+void DynamicReplicationGridNode::AddViewpoint(int32 clientIndex, const Vector3& location)
+{
+    int32 slot = _clientSlots[clientIndex];
+    if (slot == -1)
+    {
+        slot = _clientIndices.Count();
+        _clientSlots[clientIndex] = slot;
+        _clientIndices.Add(clientIndex);
+        _clientViewStart.Add(_viewX.Count());
+        _clientViewCount.Add(0);
+    }
+    else if (_clientViewStart[slot] + _clientViewCount[slot] != _viewX.Count())
+    {
+        // Viewpoints of the client are not next to each other
+        return;
+    }
+    _viewX.Add(location.X);
+    _viewY.Add(location.Y);
+    _viewZ.Add(location.Z);
+    _clientViewCount[slot]++;
+}
+
+void DynamicReplicationGridNode::ComputeClientDistances(const Vector3& position)
+{
+    // Distance to all viewpoints (SoA layout allows compiler to vectorize the loop)
+    const int32 viewsCount = _viewX.Count();
+    const Real* viewX = _viewX.Get();
+    const Real* viewY = _viewY.Get();
+    const Real* viewZ = _viewZ.Get();
+    Real* viewDistanceSq = _viewDistanceSq.Get();
+    const Real x = position.X, y = position.Y, z = position.Z;
+    for (int32 i = 0; i < viewsCount; i++)
+    {
+        const Real dx = viewX[i] - x;
+        const Real dy = viewY[i] - y;
+        const Real dz = viewZ[i] - z;
+        viewDistanceSq[i] = dx * dx + dy * dy + dz * dz;
+    }
+
+    // Pick the closest viewpoint of each client (union of viewpoints relevancy)
+    for (int32 slot = 0; slot < _clientIndices.Count(); slot++)
+    {
+        const int32 start = _clientViewStart[slot], end = start + _clientViewCount[slot];
+        Real distanceSq = viewDistanceSq[start];
+        for (int32 i = start + 1; i < end; i++)
+            distanceSq = Math::Min(distanceSq, viewDistanceSq[i]);
+        _clientDistanceSq[slot] = distanceSq;
+    }
+}
+
+Real DynamicReplicationGridNode::GetClientDistanceSq(int32 slot, const Vector3& position) const
+{
+    const int32 start = _clientViewStart[slot], end = start + _clientViewCount[slot];
+    Real distanceSq = MAX_Real;
+    for (int32 i = start; i < end; i++)
+        distanceSq = Math::Min(distanceSq, Vector3::DistanceSquared(position, Vector3(_viewX[i], _viewY[i], _viewZ[i])));
+    return distanceSq;
+}
+
+bool DynamicReplicationGridNode::ApplyLODs(Item& item, NetworkClientsMask& targetClients)
+{
+    const Array<LOD>& lods = _lods[item.LODs];
+    const uint16 sendCounter = item.SendCounter++;
+    for (int32 i = 0; i < _clientIndices.Count(); i++)
+    {
+        const int32 clientIndex = _clientIndices[i];
+        if (!targetClients.HasBit(clientIndex))
+            continue;
+
+        // Find the level of detail for the client
+        const Real distanceSq = _clientDistanceSq[i];
+        float replicationFPS = item.Object.ReplicationFPS;
+        for (const LOD& lod : lods)
+        {
+            if (distanceSq < lod.DistanceSq)
+                break;
+            replicationFPS = lod.ReplicationFPS;
+        }
+
+        // Send every N-th object update to match the lower rate
+        if (replicationFPS <= 0.0f)
+        {
+            targetClients.UnsetBit(clientIndex);
+        }
+        else if (replicationFPS < item.Object.ReplicationFPS)
+        {
+            const int32 interval = Math::Max(Math::RoundToInt(item.Object.ReplicationFPS / replicationFPS), 1);
+            if (sendCounter % interval != 0)
+                targetClients.UnsetBit(clientIndex);
+        }
+    }
+    return (bool)targetClients;
+}
+
+void DynamicReplicationGridNode::SendCandidates(NetworkReplicationHierarchyUpdateResult* result, int32 clientsCount)
+{
+    PROFILE_CPU();
+
+    // Pick the objects with the highest priority that fit into the budget of each client
+    for (int32 clientIndex = 0; clientIndex < clientsCount; clientIndex++)
+    {
+        const int32 slot = _clientSlots[clientIndex];
+        _clientQueue.Clear();
+        for (int32 i = 0; i < _candidates.Count(); i++)
+        {
+            const Candidate& candidate = _candidates[i];
+            if (!candidate.TargetClients.HasBit(clientIndex))
+                continue;
+            const Item& item = *candidate.Entry;
+            float priority = item.PriorityWeight * (float)(1 + item.WaitingUpdates);
+            if (slot != -1 && candidate.HasPosition && item.Object.CullDistance > 0.0f)
+            {
+                // Closer objects are more important (down to 10% priority at the cull distance)
+                const float distance = (float)Math::Sqrt(GetClientDistanceSq(slot, candidate.Position));
+                priority *= 1.0f - 0.9f * Math::Saturate(distance / item.Object.CullDistance);
+            }
+            _clientQueue.Add({ priority, i });
+        }
+        Sorting::QuickSort(_clientQueue.Get(), _clientQueue.Count());
+        int32 budget = BudgetPerClient, sent = 0;
+        for (const auto& e : _clientQueue)
+        {
+            Candidate& candidate = _candidates[e.CandidateIndex];
+            const int32 size = candidate.Entry->EstimatedSize;
+            if (size > budget && budget != BudgetPerClient)
+                continue; // Always send at least a single object
+            candidate.SendClients.SetBit(clientIndex);
+            budget -= size;
+            sent++;
+            if (budget <= 0)
+                break;
+        }
+        if (TrackClientStats)
+        {
+            _clientBytes[clientIndex] += BudgetPerClient - Math::Min(budget, BudgetPerClient);
+            _clientQueueDepth[clientIndex] += _clientQueue.Count() - sent;
+        }
+    }
+
+    // Send objects and delay the remaining ones
+    const float networkFPS = NetworkManager::NetworkFPS / result->ReplicationScale;
+    for (const Candidate& candidate : _candidates)
+    {
+        Item& item = *candidate.Entry;
+        if (candidate.SendClients)
+        {
+            result->AddObject(item.Object.Object, candidate.SendClients);
+            if (Stats)
+                RecordSent(item, candidate.SendClients, clientsCount, candidate.CellStats);
+            UnsetBits(item.PendingClients, candidate.SendClients, clientsCount);
+        }
+        if (item.PendingClients)
+        {
+            // Stay relevant in the next update with higher priority
+            if (item.WaitingUpdates < MAX_uint16)
+                item.WaitingUpdates++;
+        }
+        else
+        {
+            item.WaitingUpdates = 0;
+            item.Object.ReplicationUpdatesLeft = GetUpdatesInterval(networkFPS, item.Object.ReplicationFPS);
+        }
+    }
+    _candidates.Clear();
+}
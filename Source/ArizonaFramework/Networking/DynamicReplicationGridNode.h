@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Engine/Networking/NetworkReplicationHierarchy.h"
+#include "Engine/Core/Math/Int3.h"
+#include "Engine/Core/Types/Pair.h"
+#include "ReplicationStats.h"
+
+/// <summary>
+/// Network replication hierarchy node with a spatial grid for moving actors. Objects are re-bucketed when they cross the cell boundaries (checked only when the object is due for the replication update). Always relevant objects are kept outside the grid. Objects without an actor are kept in a separate non-spatial cell per interest group (never culled by distance). Distance culling is performed per-cell for each client and cells that are out of range for all clients are skipped. Supports replication levels of detail evaluated per-client and interest groups (objects in a group are replicated only to clients subscribed to it).
+/// </summary>
+API_CLASS() class ARIZONAFRAMEWORK_API DynamicReplicationGridNode : public NetworkReplicationNode
+{
+    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(DynamicReplicationGridNode, NetworkReplicationNode);
+
+private:
+    struct Item
+    {
+        NetworkReplicationHierarchyObject Object;
+        // Clients that still wait for the object update (when using bandwidth budget). Indexed by client position (reset when clients list changes).
+        NetworkClientsMask PendingClients;
+        // Updates since the object got relevant for replication (when using bandwidth budget).
+        uint16 WaitingUpdates;
+        // Counter of the object replication updates (used to send updates at lower rate to clients using the further levels of detail).
+        uint16 SendCounter;
+        // Index of the replication levels of detail (or -1 if unused).
+        int32 LODs;
+        // Interest group of the object (0 if relevant to all clients).
+        uint32 Group;
+        float PriorityWeight;
+        int32 EstimatedSize;
+    };
+
+    struct CellKey
+    {
+        Int3 Coord;
+        uint32 Group;
+
+        bool operator==(const CellKey& other) const
+        {
+            return Coord == other.Coord && Group == other.Group;
+        }
+
+        bool operator!=(const CellKey& other) const
+        {
+            return !operator==(other);
+        }
+
+        friend uint32 GetHash(const CellKey& key)
+        {
+            return ((uint32)key.Coord.X * 73856093u) ^ ((uint32)key.Coord.Y * 19349663u) ^ ((uint32)key.Coord.Z * 83492791u) ^ (key.Group * 2654435761u);
+        }
+    };
+
+    struct Cell
+    {
+        Array<Item> Items;
+        // Range of the objects cull distance (objects without culling use infinite distance).
+        float MinCullDistance;
+        float MaxCullDistance;
+        // True if objects were removed from the cell and the cull distance range needs to be refreshed.
+        bool CullDistanceDirty;
+
+        void AddCullDistance(float cullDistance)
+        {
+            if (cullDistance <= 0.0f)
+            {
+                MaxCullDistance = MAX_float;
+                return;
+            }
+            MinCullDistance = Math::Min(MinCullDistance, cullDistance);
+            MaxCullDistance = Math::Max(MaxCullDistance, cullDistance);
+        }
+    };
+
+    struct Candidate
+    {
+        Item* Entry;
+        Vector3 Position;
+        // False for objects without an actor (position is not used for the priority).
+        bool HasPosition;
+        NetworkClientsMask TargetClients;
+        NetworkClientsMask SendClients;
+        int32 CellStats;
+    };
+
+    struct LOD
+    {
+        Real DistanceSq;
+        float ReplicationFPS;
+
+        bool operator<(const LOD& other) const
+        {
+            return DistanceSq < other.DistanceSq;
+        }
+    };
+
+    struct QueueItem
+    {
+        float Priority;
+        int32 CandidateIndex;
+
+        bool operator<(const QueueItem& other) const
+        {
+            return Priority > other.Priority; // Sort in descending order
+        }
+    };
+
+    Dictionary<CellKey, Cell> _cells;
+    // Objects with replication rate not limited (never culled, kept outside the grid).
+    Array<Item> _alwaysRelevant;
+    Dictionary<ScriptingObject*, CellKey> _objectToCell;
+    Array<Pair<ScriptingObject*, CellKey>> _movedObjects;
+    // Clients viewpoints in SoA layout (grouped per-client).
+    Array<Real> _viewX, _viewY, _viewZ, _viewDistanceSq;
+    // Clients with viewpoints (per-slot).
+    Array<int32> _clientIndices, _clientViewStart, _clientViewCount;
+    Array<Real> _clientDistanceSq;
+    // Client index to slot mapping (or -1 if client has no viewpoint).
+    Array<int32> _clientSlots;
+    Array<Candidate> _candidates;
+    Array<QueueItem> _clientQueue;
+    Array<float> _clientAccumulators;
+    // ClientId of each client from the last update (used to detect clients list changes).
+    Array<uint32> _clientIds;
+    Array<Array<LOD>> _lods;
+    Dictionary<ScriptingTypeHandle, int32> _lodsPerType;
+    // Version of the replication settings used by the objects (see ReplicationHierarchy::GetSettingsVersion).
+    uint32 _settingsVersion = 0;
+    Array<int32> _clientBytes;
+    Array<int32> _clientQueueDepth;
+
+public:
+    /// <summary>
+    /// Size of the grid cell (in world units). Used to bucket objects for replication culling.
+    /// </summary>
+    API_FIELD() float CellSize = 10000.0f;
+
+    /// <summary>
+    /// The maximum amount of bytes (estimated from the objects replication settings) to replicate to a single client within a network update. Relevant objects are sent by priority (per-type weight, distance to the client and time waiting for the update) and the ones over budget are delayed to the next updates. Use 0 for unlimited.
+    /// </summary>
+    API_FIELD() int32 BudgetPerClient = 0;
+
+    // Per-client replication scale (indexed by the client index, missing entries use 1). Clients with lower scale skip some of the network updates.
+    Array<float> ClientScales;
+
+    // Relevancy viewpoints of the clients (multiple per-client are allowed, eg. local coop players or spectator cameras). Objects are relevant if they're in range of any of the client viewpoints. If empty, a single client location from the update result is used.
+    Array<Vector3> ClientViewpoints;
+
+    // Client index for each of ClientViewpoints (viewpoints of the same client should be next to each other).
+    Array<int32> ClientViewpointIndices;
+
+    // Clients subscribed to the interest groups (group -> clients mask). Cells of groups without any subscribed client are skipped.
+    Dictionary<uint32, NetworkClientsMask> GroupClients;
+
+    // Output statistics (gathered only if not null, cleared by the owner before the update).
+    ReplicationStats* Stats = nullptr;
+
+    // Enables gathering per-client statistics (estimated bytes sent and queue depth).
+    bool TrackClientStats = false;
+
+    // Gets the estimated amount of bytes sent to each client within the last update (if TrackClientStats is enabled).
+    FORCE_INLINE const Array<int32>& GetClientBytes() const
+    {
+        return _clientBytes;
+    }
+
+    // Gets the amount of objects delayed due to bandwidth budget for each client within the last update (if TrackClientStats is enabled).
+    FORCE_INLINE const Array<int32>& GetClientQueueDepth() const
+    {
+        return _clientQueueDepth;
+    }
+
+    // Adds the object within the interest group (0 if relevant to all clients).
+    void AddGroupObject(const NetworkReplicationHierarchyObject& obj, uint32 group);
+
+    // Changes the interest group of the object (applied in the next update). Returns false if object is not in this node.
+    bool SetObjectGroup(ScriptingObject* obj, uint32 group);
+
+    // [NetworkReplicationNode]
+    void AddObject(NetworkReplicationHierarchyObject obj) override;
+    bool RemoveObject(ScriptingObject* obj) override;
+    bool DirtyObject(ScriptingObject* obj) override;
+    void Update(NetworkReplicationHierarchyUpdateResult* result) override;
+
+private:
+    Int3 GetCellCoord(const Vector3& position) const;
+    CellKey GetCellKey(const Item& item) const;
+    void ApplySettings(Item& item);
+    void UpdateSettings();
+    void AddToCell(const CellKey& key, const Item& item);
+    Item* FindItem(ScriptingObject* obj);
+    void UpdateCells();
+    void UpdateClients(int32 clientsCount);
+    void SkipCell(const CellKey& key, Cell& cell, float networkFPS);
+    void SendCandidates(NetworkReplicationHierarchyUpdateResult* result, int32 clientsCount);
+    void AddClientBytes(const NetworkClientsMask& clients, int32 size, int32 clientsCount);
+    void RecordSent(const Item& item, const NetworkClientsMask& clients, int32 clientsCount, int32 cellStats);
+    void GatherViewpoints(NetworkReplicationHierarchyUpdateResult* result, int32 clientsCount);
+    void AddViewpoint(int32 clientIndex, const Vector3& location);
+    void ComputeClientDistances(const Vector3& position);
+    Real GetClientDistanceSq(int32 slot, const Vector3& position) const;
+    bool ApplyLODs(Item& item, NetworkClientsMask& targetClients);
+};
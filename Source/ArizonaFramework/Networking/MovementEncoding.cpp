@@ -0,0 +1,81 @@
+#include "MovementEncoding.h"
+#include "Engine/Core/Math/Math.h"
+
+namespace
+{
+    // Range of the smallest three components of the normalized quaternion (1/sqrt(2)).
+    constexpr float RotationRange = 0.70710678f;
+    constexpr int32 RotationBits = 10;
+    constexpr int32 RotationMask = (1 << RotationBits) - 1;
+    // Amount of steps on each side of zero (grid is symmetric so zero and the range bounds are encoded exactly).
+    constexpr int32 RotationSteps = (1 << (RotationBits - 1)) - 1;
+}
+
+bool MovementQuantization::EncodeTranslation(const Vector3& value, float precision, int16& x, int16& y, int16& z)
+{
+    const Real scale = 1.0f / precision;
+    const Real limit = MAX_int16;
+    const Real qx = Math::Round(value.X * scale), qy = Math::Round(value.Y * scale), qz = Math::Round(value.Z * scale);
+    if (Math::Abs(qx) > limit || Math::Abs(qy) > limit || Math::Abs(qz) > limit)
+        return false;
+    x = (int16)qx;
+    y = (int16)qy;
+    z = (int16)qz;
+    return true;
+}
+
+Vector3 MovementQuantization::DecodeTranslation(int16 x, int16 y, int16 z, float precision)
+{
+    return Vector3((Real)x * precision, (Real)y * precision, (Real)z * precision);
+}
+
+uint32 MovementQuantization::EncodeRotation(const Quaternion& value)
+{
+    Quaternion q = value;
+    q.Normalize();
+    const float components[4] = { q.X, q.Y, q.Z, q.W };
+
+    // Skip the largest component (it's reconstructed from the other ones). On ties the first one is used (the others are then at the range bounds which encode exactly).
+    int32 largest = 0;
+    for (int32 i = 1; i < 4; i++)
+    {
+        if (Math::Abs(components[i]) > Math::Abs(components[largest]))
+            largest = i;
+    }
+    // Quaternions q and -q represent the same rotation so flip the sign to keep the largest component positive
+    const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+    uint32 result = (uint32)largest << (RotationBits * 3);
+    int32 shift = RotationBits * 2;
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i == largest)
+            continue;
+        const int32 quantized = Math::Clamp(Math::RoundToInt(components[i] * sign / RotationRange * RotationSteps), -RotationSteps, RotationSteps) + RotationSteps;
+        result |= (uint32)quantized << shift;
+        shift -= RotationBits;
+    }
+    return result;
+}
+
+Quaternion MovementQuantization::DecodeRotation(uint32 value)
+{
+    const int32 largest = (int32)(value >> (RotationBits * 3)) & 3;
+    float components[4];
+    float sumSquares = 0.0f;
+    int32 shift = RotationBits * 2;
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i == largest)
+            continue;
+        const int32 quantized = ((int32)(value >> shift) & RotationMask) - RotationSteps;
+        const float component = (float)quantized / RotationSteps * RotationRange;
+        components[i] = component;
+        sumSquares += component * component;
+        shift -= RotationBits;
+    }
+    components[largest] = Math::Sqrt(Math::Max(1.0f - sumSquares, 0.0f));
+    Quaternion result(components[0], components[1], components[2], components[3]);
+    result.Normalize();
+    return result;
+}
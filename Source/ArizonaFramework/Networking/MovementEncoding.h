@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
+
+/// <summary>
+/// Encoding of the pawn movement sent by Player Controller from client to server.
+/// </summary>
+API_ENUM() enum class PawnMovementEncoding
+{
+    /// <summary>
+    /// Full-precision translation vector and rotation quaternion.
+    /// </summary>
+    Full,
+
+    /// <summary>
+    /// Quantized translation delta (16-bit fixed-point per component) and rotation (smallest-three compression into 32 bits). Falls back to full precision for deltas out of the encoding range.
+    /// </summary>
+    Compact,
+};
+
+// Quantization utilities for compact pawn movement encoding.
+class ARIZONAFRAMEWORK_API MovementQuantization
+{
+public:
+    // Encodes translation delta into 16-bit fixed-point components (precision is a size of the single step in world units, max error per component is half of it plus floating-point rounding). Returns false if value exceeds the encoding range (32767 steps in either direction).
+    static bool EncodeTranslation(const Vector3& value, float precision, int16& x, int16& y, int16& z);
+
+    // Decodes translation delta from 16-bit fixed-point components.
+    static Vector3 DecodeTranslation(int16 x, int16 y, int16 z, float precision);
+
+    // Encodes rotation quaternion with smallest-three compression (2 bits for the largest component index and 10 bits for each of the remaining components). Encoded components have max error of 0.0007 (zero and 1/sqrt(2) are exact). The decoded quaternion is normalized and may have the opposite sign (the same rotation), its max error per component is below 0.002 (below 0.3 degree of rotation angle).
+    static uint32 EncodeRotation(const Quaternion& value);
+
+    // Decodes rotation quaternion from smallest-three compression.
+    static Quaternion DecodeRotation(uint32 value);
+};
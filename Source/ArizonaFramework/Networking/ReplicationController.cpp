@@ -0,0 +1,87 @@
+#include "ReplicationController.h"
+#include "DynamicReplicationGridNode.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Networking/NetworkClient.h"
+#include "Engine/Networking/NetworkManager.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+namespace
+{
+    // Smoothing factor for measurements (exponential moving average).
+    constexpr float MeasureSmoothing = 0.1f;
+}
+
+void ReplicationController::Reset()
+{
+    Stats = ReplicationControllerStats();
+    _clients.Clear();
+}
+
+void ReplicationController::Update(const AdaptiveReplicationSettings& settings, DynamicReplicationGridNode* grid, int32 clientsCount)
+{
+    PROFILE_CPU();
+    const float minScale = Math::Clamp(settings.MinScale, 0.01f, 1.0f);
+    const float maxScale = Math::Max(settings.MaxScale, minScale);
+    const float updateDeltaTime = NetworkManager::NetworkFPS > 0.0f ? 1.0f / NetworkManager::NetworkFPS : (float)Time::Update.UnscaledDeltaTime.GetTotalSeconds();
+
+    // Global scale from the server update time (frame interval would include idle time when running at capped frame rate)
+    const float frameTime = (float)((Platform::GetTimeSeconds() - Time::Update.LastBegin) * 1000.0);
+    Stats.FrameTime = Stats.FrameTime > 0.0f ? Math::Lerp(Stats.FrameTime, frameTime, MeasureSmoothing) : frameTime;
+    Stats.TargetFrameTime = settings.TargetFrameTime > 0.0f ? settings.TargetFrameTime : (Time::UpdateFPS > 0.0f ? 1000.0f / Time::UpdateFPS : 0.0f);
+    if (Stats.TargetFrameTime > 0.0f && Stats.FrameTime > Stats.TargetFrameTime * 1.1f)
+        Stats.GlobalScale *= 1.0f - settings.DecreaseRate;
+    else if (Stats.TargetFrameTime <= 0.0f || Stats.FrameTime < Stats.TargetFrameTime * 0.9f)
+        Stats.GlobalScale += settings.IncreaseRate * updateDeltaTime;
+    Stats.GlobalScale = Math::Clamp(Stats.GlobalScale, minScale, maxScale);
+
+    // Per-client scales from the sent data and queue depth
+    _updateIndex++;
+    Stats.ClientScales.Resize(clientsCount);
+    Stats.ClientBytesPerSecond.Resize(clientsCount);
+    Stats.ClientQueueDepth.Resize(clientsCount);
+    Stats.ThrottledClients = 0;
+    const Array<int32>* clientBytes = grid ? &grid->GetClientBytes() : nullptr;
+    const Array<int32>* clientQueueDepth = grid ? &grid->GetClientQueueDepth() : nullptr;
+    for (int32 i = 0; i < clientsCount; i++)
+    {
+        const uint32 clientId = NetworkManager::Clients[i]->ClientId;
+        ClientState* client = _clients.TryGet(clientId);
+        if (!client)
+        {
+            client = &_clients[clientId];
+            client->Scale = 1.0f;
+            client->BytesPerSecond = 0.0f;
+        }
+        client->UpdateIndex = _updateIndex;
+        float& scale = client->Scale;
+        float& bytesPerSecond = client->BytesPerSecond;
+        int32& queueDepth = Stats.ClientQueueDepth[i];
+        const float bytes = clientBytes && i < clientBytes->Count() ? (float)clientBytes->At(i) / updateDeltaTime : 0.0f;
+        bytesPerSecond = Math::Lerp(bytesPerSecond, bytes, MeasureSmoothing);
+        queueDepth = clientQueueDepth && i < clientQueueDepth->Count() ? clientQueueDepth->At(i) : 0;
+        const bool overBandwidth = settings.TargetBytesPerClient > 0 && bytesPerSecond > (float)settings.TargetBytesPerClient;
+        const bool overQueue = settings.MaxQueueDepth > 0 && queueDepth > settings.MaxQueueDepth;
+        if (overBandwidth || overQueue)
+            scale *= 1.0f - settings.DecreaseRate;
+        else
+            scale += settings.IncreaseRate * updateDeltaTime;
+        scale = Math::Clamp(scale, minScale, 1.0f);
+        if (scale < 1.0f)
+            Stats.ThrottledClients++;
+        Stats.ClientScales[i] = scale;
+        Stats.ClientBytesPerSecond[i] = bytesPerSecond;
+    }
+
+    // Remove state of disconnected clients
+    if (_clients.Count() > clientsCount)
+    {
+        for (auto it = _clients.Begin(); it.IsNotEnd(); ++it)
+        {
+            if (it->Value.UpdateIndex != _updateIndex)
+                _clients.Remove(it);
+        }
+    }
+    if (grid)
+        grid->ClientScales = Stats.ClientScales;
+}
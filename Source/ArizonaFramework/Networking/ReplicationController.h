@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/ISerializable.h"
+#include "ReplicationSettings.h"
+
+class DynamicReplicationGridNode;
+
+/// <summary>
+/// Adaptive replication controller statistics.
+/// </summary>
+API_STRUCT(NoDefault) struct ARIZONAFRAMEWORK_API ReplicationControllerStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ReplicationControllerStats);
+
+    /// <summary>
+    /// The smoothed server update time (in milliseconds). Measured from the frame update begin to the network replication (excludes idle time waiting for the next frame).
+    /// </summary>
+    API_FIELD() float FrameTime = 0.0f;
+
+    /// <summary>
+    /// The target server frame time (in milliseconds).
+    /// </summary>
+    API_FIELD() float TargetFrameTime = 0.0f;
+
+    /// <summary>
+    /// The replication scale applied to all objects (excluding manual ReplicationHierarchy.ReplicationScale).
+    /// </summary>
+    API_FIELD() float GlobalScale = 1.0f;
+
+    /// <summary>
+    /// The amount of clients with reduced replication scale.
+    /// </summary>
+    API_FIELD() int32 ThrottledClients = 0;
+
+    /// <summary>
+    /// The replication scale per-client (indexed by the client index in NetworkManager.Clients).
+    /// </summary>
+    API_FIELD() Array<float> ClientScales;
+
+    /// <summary>
+    /// The smoothed amount of data sent to each client (in bytes per second, estimated from replication settings).
+    /// </summary>
+    API_FIELD() Array<float> ClientBytesPerSecond;
+
+    /// <summary>
+    /// The amount of objects waiting for replication to each client (over bandwidth budget).
+    /// </summary>
+    API_FIELD() Array<int32> ClientQueueDepth;
+};
+
+// Feedback controller that adjusts replication scale based on the measured server frame time and per-client bandwidth. Uses multiplicative decrease on overload and additive increase otherwise.
+class ARIZONAFRAMEWORK_API ReplicationController
+{
+private:
+    struct ClientState
+    {
+        float Scale;
+        float BytesPerSecond;
+        uint32 UpdateIndex;
+    };
+
+    // Per-client state (key is ClientId) to keep measurements when clients list changes.
+    Dictionary<uint32, ClientState> _clients;
+    uint32 _updateIndex = 0;
+
+public:
+    ReplicationControllerStats Stats;
+
+    // Resets the controller state.
+    void Reset();
+
+    // Updates the controller with measurements from the last network update and applies per-client scales to the grid node.
+    void Update(const AdaptiveReplicationSettings& settings, DynamicReplicationGridNode* grid, int32 clientsCount);
+};
@@ -1,77 +1,326 @@
 #include "ReplicationHierarchy.h"
+#include "DynamicReplicationGridNode.h"
 #include "ArizonaFramework/Core/GameInstance.h"
 #include "ArizonaFramework/Core/GameInstanceSettings.h"
 #include "ArizonaFramework/Core/GameState.h"
+#include "ArizonaFramework/Core/PlayerController.h"
 #include "ArizonaFramework/Core/PlayerPawn.h"
 #include "ArizonaFramework/Core/PlayerState.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Networking/NetworkClient.h"
 #include "Engine/Networking/NetworkManager.h"
+#include "Engine/Networking/NetworkReplicator.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Scripting/BinaryModule.h"
+#include "Engine/Scripting/Scripting.h"
 
 Dictionary<ScriptingTypeHandle, ReplicationSettings> GlobalReplicationSettings;
+Dictionary<Guid, uint32> ObjectGroups;
+Dictionary<uint32, Array<uint32, InlinedAllocation<4>>> ClientGroups;
 float ReplicationHierarchy::ReplicationScale = 1.0f;
+bool ReplicationHierarchy::StatsEnabled = false;
+
+namespace
+{
+    // Flattened replication settings for all types of the loaded binary modules (indexed with type index).
+    Dictionary<BinaryModule*, Array<ReplicationSettings>> SettingsTable;
+    Dictionary<ScriptingTypeHandle, ReplicationSettings> SettingsOverrides;
+    bool SettingsTableValid = false;
+    uint32 SettingsVersion = 0;
+#if USE_EDITOR
+    bool SettingsTableBound = false;
+#endif
+
+    const ReplicationSettings& GetTableSettings(const ScriptingTypeHandle& typeHandle);
+
+    void ResolveSettings(BinaryModule* module, int32 typeIndex, Array<ReplicationSettings>& settings, Array<bool>& resolved)
+    {
+        if (resolved[typeIndex])
+            return;
+        resolved[typeIndex] = true;
+        const ScriptingTypeHandle typeHandle(module, typeIndex);
+        if (SettingsOverrides.TryGet(typeHandle, settings[typeIndex]))
+            return;
+        const ScriptingTypeHandle baseTypeHandle = typeHandle.GetType().GetBaseType();
+        if (!baseTypeHandle)
+        {
+            settings[typeIndex] = GameInstanceSettings::Get()->DefaultReplicationSettings;
+        }
+        else if (baseTypeHandle.Module == module)
+        {
+            ResolveSettings(module, baseTypeHandle.TypeIndex, settings, resolved);
+            settings[typeIndex] = settings[baseTypeHandle.TypeIndex];
+        }
+        else
+        {
+            settings[typeIndex] = GetTableSettings(baseTypeHandle);
+        }
+    }
+
+    const Array<ReplicationSettings>& BuildModuleSettings(BinaryModule* module)
+    {
+        // Base types from other modules are resolved (and inserted into the table) before adding this module
+        const int32 typesCount = module->Types.Count();
+        Array<ReplicationSettings> settings;
+        settings.Resize(typesCount);
+        Array<bool> resolved;
+        resolved.Resize(typesCount);
+        resolved.SetAll(false);
+        for (int32 typeIndex = 0; typeIndex < typesCount; typeIndex++)
+            ResolveSettings(module, typeIndex, settings, resolved);
+        return SettingsTable[module] = MoveTemp(settings);
+    }
+
+    void BuildSettingsTable()
+    {
+        PROFILE_CPU();
+        SettingsTableValid = true;
+        SettingsTable.Clear();
+        SettingsOverrides.Clear();
+#if USE_EDITOR
+        if (!SettingsTableBound)
+        {
+            SettingsTableBound = true;
+            Scripting::ScriptsReloading.Bind<&ReplicationHierarchy::InvalidateSettings>();
+        }
+#endif
+
+        // Game and player states are change-tracked (replicated when dirty, with a low keep-alive rate)
+        const auto& gameSettings = *GameInstanceSettings::Get();
+        ReplicationSettings stateSettings = gameSettings.DefaultReplicationSettings;
+        stateSettings.ReplicationFPS = gameSettings.StateReplicationFPS;
+        stateSettings.CullDistance = 0.0f;
+        SettingsOverrides[GameState::TypeInitializer] = stateSettings;
+        SettingsOverrides[PlayerState::TypeInitializer] = stateSettings;
+
+        // Flatten overrides from game settings and code (code has priority)
+        for (const auto& e : gameSettings.ReplicationSettingsPerType)
+        {
+            const ScriptingTypeHandle typeHandle = e.Key.GetType();
+            if (typeHandle)
+                SettingsOverrides[typeHandle] = e.Value;
+        }
+        for (const auto& e : GlobalReplicationSettings)
+            SettingsOverrides[e.Key] = e.Value;
+
+        for (BinaryModule* module : BinaryModule::GetModules())
+        {
+            if (!SettingsTable.ContainsKey(module))
+                BuildModuleSettings(module);
+        }
+    }
+
+    const ReplicationSettings& GetTableSettings(const ScriptingTypeHandle& typeHandle)
+    {
+        if (!SettingsTableValid)
+            BuildSettingsTable();
+        const Array<ReplicationSettings>* settings = SettingsTable.TryGet(typeHandle.Module);
+        if (!settings || typeHandle.TypeIndex >= settings->Count())
+        {
+            // Module loaded after the table was built
+            settings = &BuildModuleSettings(typeHandle.Module);
+        }
+        return settings->At(typeHandle.TypeIndex);
+    }
+}
 
 ReplicationHierarchy::~ReplicationHierarchy()
 {
     SAFE_DELETE(_grid);
+    SAFE_DELETE(_dynamicGrid);
 }
 
 void ReplicationHierarchy::SetSettings(ScriptingTypeHandle type, const ReplicationSettings& settings)
 {
     GlobalReplicationSettings[type] = settings;
+    InvalidateSettings();
 #if USE_EDITOR
     // TODO: register event for type.Module unloading to safely remove type ref
 #endif
 }
 
-void ReplicationHierarchy::AddObject(NetworkReplicationHierarchyObject obj)
+ReplicationSettings ReplicationHierarchy::GetSettings(ScriptingTypeHandle type)
 {
-    // Get object settings
-    ScriptingTypeHandle typeHandle = obj.Object->GetTypeHandle();
-    ReplicationSettings settings;
-    if (!_settingsCache.TryGet(typeHandle, settings))
-    {
-        // Resolve settings
-        const auto& gameSettings = GameInstanceSettings::Get();
-        settings = gameSettings->DefaultReplicationSettings;
-        while (typeHandle)
-        {
-            // Overriden by code
-            if (GlobalReplicationSettings.TryGet(typeHandle, settings))
-                break;
+    if (!type)
+        return GameInstanceSettings::Get()->DefaultReplicationSettings;
+    return GetTableSettings(type);
+}
+
+void ReplicationHierarchy::InvalidateSettings()
+{
+    SettingsTableValid = false;
+    SettingsTable.Clear();
+    SettingsVersion++;
+}
+
+uint32 ReplicationHierarchy::GetSettingsVersion()
+{
+    return SettingsVersion;
+}
+
+void ReplicationHierarchy::SetObjectGroup(ScriptingObject* obj, uint32 group)
+{
+    if (!obj)
+        return;
+    if (group != 0)
+        ObjectGroups[obj->GetID()] = group;
+    else
+        ObjectGroups.Remove(obj->GetID());
+    if (auto* hierarchy = ScriptingObject::Cast<ReplicationHierarchy>(NetworkReplicator::GetHierarchy()))
+        hierarchy->OnObjectGroupChanged(obj, group);
+}
+
+uint32 ReplicationHierarchy::GetObjectGroup(ScriptingObject* obj)
+{
+    uint32 group = 0;
+    if (obj)
+        ObjectGroups.TryGet(obj->GetID(), group);
+    return group;
+}
+
+void ReplicationHierarchy::AddClientGroup(uint32 clientId, uint32 group)
+{
+    ClientGroups[clientId].AddUnique(group);
+}
+
+void ReplicationHierarchy::RemoveClientGroup(uint32 clientId, uint32 group)
+{
+    if (auto* groups = ClientGroups.TryGet(clientId))
+        groups->Remove(group);
+}
+
+void ReplicationHierarchy::ClearClientGroups(uint32 clientId)
+{
+    ClientGroups.Remove(clientId);
+}
+
+void ReplicationHierarchy::OnObjectGroupChanged(ScriptingObject* obj, uint32 group)
+{
+    if (_dynamicGrid && _dynamicGrid->SetObjectGroup(obj, group))
+        return;
+    if (group == 0)
+        return;
 
-            // Overriden by game settings
-            const ScriptingType& type = typeHandle.GetType();
-            if (gameSettings->ReplicationSettingsPerType.TryGet(type.Fullname, settings))
-                break;
+    // Move object from the list into the dynamic grid that supports groups
+    for (int32 i = 0; i < Objects.Count(); i++)
+    {
+        if (Objects[i].Object == obj)
+        {
+            const NetworkReplicationHierarchyObject e = Objects[i];
+            NetworkReplicationHierarchy::RemoveObject(obj);
+            if (!_dynamicGrid)
+                _dynamicGrid = New<DynamicReplicationGridNode>();
+            _dynamicGrid->AddGroupObject(e, group);
+            break;
+        }
+    }
+}
 
-            typeHandle = type.GetBaseType();
+void ReplicationHierarchy::UpdateObjects(NetworkReplicationHierarchyUpdateResult* result)
+{
+    // Objects outside the grids (same as NetworkReplicationNode::Update but with statistics and multiple viewpoints per-client)
+    const int32 clientsCount = NetworkManager::Clients.Count();
+    const float networkFPS = NetworkManager::NetworkFPS / result->ReplicationScale;
+    NetworkClientsMask clientsWithViewpoints;
+    for (const int32 clientIndex : _viewpointClients)
+        clientsWithViewpoints.SetBit(clientIndex);
+    for (NetworkReplicationHierarchyObject& obj : Objects)
+    {
+        if (!obj.Object)
+            continue;
+        const bool alwaysRelevant = obj.ReplicationFPS <= 0.0f;
+        if (!alwaysRelevant && obj.ReplicationUpdatesLeft > 0)
+        {
+            // Move to the next frame
+            obj.ReplicationUpdatesLeft--;
+            continue;
+        }
+        NetworkClientsMask targetClients = obj.TargetClients;
+        const Actor* actor = obj.GetActor();
+        if (!alwaysRelevant && actor && obj.CullDistance > 0.0f && clientsWithViewpoints)
+        {
+            // Cull object against clients viewpoints (relevant if in range of any viewpoint of the client)
+            const Vector3 position = actor->GetPosition();
+            const Real cullDistanceSq = Math::Square(obj.CullDistance);
+            NetworkClientsMask inRange;
+            for (int32 i = 0; i < _viewpoints.Count(); i++)
+            {
+                if (Vector3::DistanceSquared(position, _viewpoints[i]) < cullDistanceSq)
+                    inRange.SetBit(_viewpointClients[i]);
+            }
+            for (int32 i = 0; i < clientsCount; i++)
+            {
+                if (clientsWithViewpoints.HasBit(i) && !inRange.HasBit(i))
+                    targetClients.UnsetBit(i);
+            }
+        }
+        const ScriptingTypeHandle typeHandle = StatsEnabled ? obj.Object->GetTypeHandle() : ScriptingTypeHandle();
+        if (StatsEnabled)
+            _stats.RecordConsidered(typeHandle);
+        if (targetClients)
+        {
+            result->AddObject(obj.Object, targetClients);
+            if (StatsEnabled)
+                _stats.RecordSent(typeHandle, Math::Max(GetTableSettings(typeHandle).EstimatedSize, 1), targetClients, clientsCount);
+        }
+        else if (StatsEnabled)
+        {
+            _stats.Culled++;
         }
 
-        // Cache result
-        typeHandle = obj.Object->GetTypeHandle();
-        _settingsCache.Add(typeHandle, settings);
+        // Calculate frames until next replication
+        if (!alwaysRelevant)
+            obj.ReplicationUpdatesLeft = (uint16)Math::Clamp<int32>(Math::RoundToInt(networkFPS / obj.ReplicationFPS) - 1, 0, MAX_uint16);
     }
+}
+
+void ReplicationHierarchy::AddObject(NetworkReplicationHierarchyObject obj)
+{
+    // Get object settings
+    const ReplicationSettings& settings = GetTableSettings(obj.Object->GetTypeHandle());
     obj.ReplicationFPS = settings.ReplicationFPS;
     obj.CullDistance = settings.CullDistance;
 
+    uint32 group = 0;
+    if (ObjectGroups.HasItems() && ObjectGroups.TryGet(obj.Object->GetID(), group))
+    {
+        // Insert objects from interest groups into a dynamic grid to skip groups without subscribed clients
+        if (!_dynamicGrid)
+            _dynamicGrid = New<DynamicReplicationGridNode>();
+        _dynamicGrid->AddGroupObject(obj, group);
+        return;
+    }
+
     const Actor* actor = obj.GetActor();
-    if (actor && actor->HasStaticFlag(StaticFlags::Transform))
+    if (actor && actor->HasStaticFlag(StaticFlags::Transform) && settings.LODs.IsEmpty())
     {
         // Insert static objects into a grid for faster replication
         if (!_grid)
-            _grid = New<NetworkReplicationGridNode>();
+            _grid = New<DynamicReplicationGridNode>();
         _grid->AddObject(obj);
         return;
     }
+    if (actor && (obj.CullDistance > 0.0f || settings.LODs.HasItems()))
+    {
+        // Insert moving objects (and ones with levels of detail) into a dynamic grid to cull them per-cell
+        if (!_dynamicGrid)
+            _dynamicGrid = New<DynamicReplicationGridNode>();
+        _dynamicGrid->AddObject(obj);
+        return;
+    }
 
     NetworkReplicationHierarchy::AddObject(obj);
 }
 
 bool ReplicationHierarchy::RemoveObject(ScriptingObject* obj)
 {
+    if (ObjectGroups.HasItems())
+        ObjectGroups.Remove(obj->GetID());
     if (_grid && _grid->RemoveObject(obj))
         return true;
+    if (_dynamicGrid && _dynamicGrid->RemoveObject(obj))
+        return true;
     return NetworkReplicationHierarchy::RemoveObject(obj);
 }
 
@@ -79,33 +328,118 @@ bool ReplicationHierarchy::DirtyObject(ScriptingObject* obj)
 {
     if (_grid && _grid->DirtyObject(obj))
         return true;
+    if (_dynamicGrid && _dynamicGrid->DirtyObject(obj))
+        return true;
     return NetworkReplicationHierarchy::DirtyObject(obj);
 }
 
 void ReplicationHierarchy::Update(NetworkReplicationHierarchyUpdateResult* result)
 {
-    if (const auto* instance = GameInstance::GetInstance())
+    const double startTime = StatsEnabled ? Platform::GetTimeSeconds() : 0.0;
+    if (StatsEnabled)
+    {
+        _stats.Frame++;
+        _stats.Clear(NetworkManager::Clients.Count());
+    }
+
+    _viewpoints.Clear();
+    _viewpointClients.Clear();
+    const auto* instance = GameInstance::GetInstance();
+    if (const auto* gameState = instance ? instance->GetGameState() : nullptr)
     {
-        // Setup players locations for distance culling
+        PROFILE_CPU_NAMED("Viewpoints");
+
+        // Setup players viewpoints for distance culling (from all local players of the client)
         const auto& clients = NetworkManager::Clients;
         for (int32 i = 0; i < clients.Count(); i++)
         {
-            if (const auto* playerState = instance->GetGameState()->GetPlayerStateByNetworkClientId(clients[i]->ClientId))
+            const int32 start = _viewpoints.Count();
+            for (const PlayerState* playerState : gameState->GetPlayerStatesByNetworkClientId(clients[i]->ClientId))
+            {
+                if (playerState->PlayerController)
+                    playerState->PlayerController->GetRelevancyViewpoints(_viewpoints);
+                else if (playerState->PlayerPawn && playerState->PlayerPawn->GetActor())
+                    _viewpoints.Add(playerState->PlayerPawn->GetActor()->GetPosition());
+            }
+            if (_viewpoints.Count() != start)
             {
-                if (playerState->PlayerPawn && playerState->PlayerPawn->GetActor())
-                {
-                    const Vector3 playerPosition = playerState->PlayerPawn->GetActor()->GetPosition();
-                    result->SetClientLocation(i, playerPosition);
-                }
+                // Engine nodes support only a single location per-client
+                result->SetClientLocation(i, _viewpoints[start]);
+                for (int32 j = start; j < _viewpoints.Count(); j++)
+                    _viewpointClients.Add(i);
             }
         }
     }
 
+    // Send change-tracked states to the newly joined clients (others receive them only when changed)
+    NetworkClientsMask newClients;
+    const auto& clients = NetworkManager::Clients;
+    for (int32 i = 0; i < clients.Count(); i++)
+    {
+        if (!_knownClients.Contains(clients[i]->ClientId))
+            newClients.SetBit(i);
+    }
+    if (newClients || _knownClients.Count() != clients.Count())
+    {
+        _knownClients.Clear();
+        for (const NetworkClient* client : clients)
+            _knownClients.Add(client->ClientId);
+    }
+    if (newClients)
+    {
+        for (const NetworkReplicationHierarchyObject& obj : Objects)
+        {
+            if (obj.Object && (obj.Object->Is<GameState>() || obj.Object->Is<PlayerState>()))
+                result->AddObject(obj.Object, newClients);
+        }
+    }
+
     // Apply settings
-    result->ReplicationScale *= ReplicationScale;
+    const auto& settings = *GameInstanceSettings::Get();
+    float replicationScale = ReplicationScale;
+    if (settings.AdaptiveReplication.Enabled)
+    {
+        _controller.Update(settings.AdaptiveReplication, _dynamicGrid, NetworkManager::Clients.Count());
+        replicationScale *= _controller.Stats.GlobalScale;
+    }
+    else
+    {
+        _controller.Reset();
+        if (_dynamicGrid)
+            _dynamicGrid->ClientScales.Clear();
+    }
+    result->ReplicationScale *= replicationScale;
 
     // Update hierarchy
     if (_grid)
+    {
+        _grid->Stats = StatsEnabled ? &_stats : nullptr;
+        _grid->ClientViewpoints = _viewpoints;
+        _grid->ClientViewpointIndices = _viewpointClients;
         _grid->Update(result);
-    NetworkReplicationHierarchy::Update(result);
+    }
+    if (_dynamicGrid)
+    {
+        _dynamicGrid->BudgetPerClient = settings.ReplicationBudgetPerClient;
+        _dynamicGrid->TrackClientStats = settings.AdaptiveReplication.Enabled;
+        _dynamicGrid->Stats = StatsEnabled ? &_stats : nullptr;
+        _dynamicGrid->ClientViewpoints = _viewpoints;
+        _dynamicGrid->ClientViewpointIndices = _viewpointClients;
+
+        // Setup interest groups subscriptions
+        _dynamicGrid->GroupClients.Clear();
+        for (int32 i = 0; i < clients.Count() && ClientGroups.HasItems(); i++)
+        {
+            if (const auto* groups = ClientGroups.TryGet(clients[i]->ClientId))
+            {
+                for (const uint32 group : *groups)
+                    _dynamicGrid->GroupClients[group].SetBit(i);
+            }
+        }
+        _dynamicGrid->Update(result);
+    }
+    UpdateObjects(result);
+
+    if (StatsEnabled)
+        _stats.UpdateTime = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
 }
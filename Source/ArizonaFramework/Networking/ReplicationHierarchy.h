@@ -2,9 +2,13 @@
 
 #include "Engine/Networking/NetworkReplicationHierarchy.h"
 #include "ReplicationSettings.h"
+#include "ReplicationController.h"
+#include "ReplicationStats.h"
+
+class DynamicReplicationGridNode;
 
 /// <summary>
-/// Basic implementation of NetworkReplicationHierarchy that uses spatial grid for static actor objects and allows to configure replication settings per-type.
+/// Basic implementation of NetworkReplicationHierarchy that uses spatial grids for static and moving actor objects and allows to configure replication settings per-type.
 /// </summary>
 API_CLASS() class ARIZONAFRAMEWORK_API ReplicationHierarchy : public NetworkReplicationHierarchy
 {
@@ -12,13 +16,37 @@ API_CLASS() class ARIZONAFRAMEWORK_API ReplicationHierarchy : public NetworkRepl
     ~ReplicationHierarchy();
 
 private:
-    NetworkReplicationGridNode* _grid = nullptr;
-    Dictionary<ScriptingTypeHandle, ReplicationSettings> _settingsCache;
+    DynamicReplicationGridNode* _grid = nullptr;
+    DynamicReplicationGridNode* _dynamicGrid = nullptr;
+    ReplicationController _controller;
+    Array<Vector3> _viewpoints;
+    Array<int32> _viewpointClients;
+    Array<uint32> _knownClients;
+    ReplicationStats _stats;
 
 public:
     // Scales globally replication rate for all objects in hierarchy (normalized scale - eg. 0.7 slows down rep rate by 30%).
     API_FIELD() static float ReplicationScale;
 
+    // Enables gathering replication statistics (objects considered, culled and sent, estimated bandwidth per type, client and grid cell). Adds a small overhead so it's disabled by default.
+    API_FIELD() static bool StatsEnabled;
+
+    /// <summary>
+    /// Gets the replication statistics from the last update (valid only if StatsEnabled is set).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE const ReplicationStats& GetStats() const
+    {
+        return _stats;
+    }
+
+    /// <summary>
+    /// Gets the adaptive replication controller statistics (see AdaptiveReplication in Game Instance Settings).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE const ReplicationControllerStats& GetControllerStats() const
+    {
+        return _controller.Stats;
+    }
+
     /// <summary>
     /// Sets the replication settings for a given type (globally).
     /// </summary>
@@ -26,9 +54,63 @@ public:
     /// <param name="settings">The replication settings.</param>
     API_FUNCTION() static void SetSettings(ScriptingTypeHandle type, const ReplicationSettings& settings);
 
+    /// <summary>
+    /// Gets the replication settings for a given type. Uses the settings table precomputed for all types (includes overrides from code, game settings and base classes).
+    /// </summary>
+    /// <param name="type">The object type.</param>
+    /// <returns>The replication settings.</returns>
+    API_FUNCTION() static ReplicationSettings GetSettings(ScriptingTypeHandle type);
+
+    /// <summary>
+    /// Invalidates the precomputed replication settings table. It will be rebuilt on the next use and the settings of objects already in the hierarchy (priority, estimated size and levels of detail) get refreshed on the next update. Called automatically when game settings or scripts get reloaded.
+    /// </summary>
+    API_FUNCTION() static void InvalidateSettings();
+
+    // Gets the counter of the replication settings changes (incremented by InvalidateSettings). Used by nodes to refresh the settings cached per-type.
+    static uint32 GetSettingsVersion();
+
+public:
+    /// <summary>
+    /// Sets the interest group of the object (eg. team, room or private instance). Objects in a group are replicated only to the clients subscribed to it. Should be set before the object gets spawned over the network (group changes of already replicated static objects are applied once they get respawned).
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    /// <param name="group">The interest group identifier. Use 0 for no group (relevant to all clients).</param>
+    API_FUNCTION() static void SetObjectGroup(ScriptingObject* obj, uint32 group);
+
+    /// <summary>
+    /// Gets the interest group of the object.
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    /// <returns>The interest group identifier or 0 if object is relevant to all clients.</returns>
+    API_FUNCTION() static uint32 GetObjectGroup(ScriptingObject* obj);
+
+    /// <summary>
+    /// Subscribes the client to the interest group to receive objects from it.
+    /// </summary>
+    /// <param name="clientId">The network client identifier.</param>
+    /// <param name="group">The interest group identifier.</param>
+    API_FUNCTION() static void AddClientGroup(uint32 clientId, uint32 group);
+
+    /// <summary>
+    /// Unsubscribes the client from the interest group.
+    /// </summary>
+    /// <param name="clientId">The network client identifier.</param>
+    /// <param name="group">The interest group identifier.</param>
+    API_FUNCTION() static void RemoveClientGroup(uint32 clientId, uint32 group);
+
+    /// <summary>
+    /// Unsubscribes the client from all interest groups. Called automatically when client disconnects.
+    /// </summary>
+    /// <param name="clientId">The network client identifier.</param>
+    API_FUNCTION() static void ClearClientGroups(uint32 clientId);
+
     // [NetworkReplicationHierarchy]
     void AddObject(NetworkReplicationHierarchyObject obj) override;
     bool RemoveObject(ScriptingObject* obj) override;
     bool DirtyObject(ScriptingObject* obj) override;
     void Update(NetworkReplicationHierarchyUpdateResult* result) override;
+
+private:
+    void OnObjectGroupChanged(ScriptingObject* obj, uint32 group);
+    void UpdateObjects(NetworkReplicationHierarchyUpdateResult* result);
 };
@@ -1,6 +1,21 @@
 #pragma once
 
 #include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Collections/Array.h"
+
+/// <summary>
+/// Network object replication level of detail. Distance band with a lower replication rate.
+/// </summary>
+API_STRUCT() struct ARIZONAFRAMEWORK_API ReplicationLOD : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ReplicationLOD);
+
+    // The minimum distance from the player to the object at which this level of detail is used.
+    API_FIELD() float Distance = 5000;
+    // The target amount of the replication updates per second at this distance. Should be lower than the object replication rate. Use 0 to skip replication.
+    API_FIELD() float ReplicationFPS = 20;
+};
 
 /// <summary>
 /// Network object replication settings container.
@@ -14,4 +29,36 @@ API_STRUCT() struct ARIZONAFRAMEWORK_API ReplicationSettings : ISerializable
     API_FIELD() float ReplicationFPS = 60;
     // The minimum distance from the player to the object at which it can process replication. For example, players further away won't receive object data. Use 0 if unused.
     API_FIELD() float CullDistance = 15000;
+    // The importance of the object when replicating with a limited bandwidth budget. Objects with higher weight are sent first. Priority grows with the time object waits for the update and decreases with the distance to the player.
+    API_FIELD() float PriorityWeight = 1.0f;
+    // The estimated size (in bytes) of the object replication data. Used to fit objects into the per-client bandwidth budget.
+    API_FIELD() int32 EstimatedSize = 100;
+    // The levels of detail with lower replication rate for players further away from the object (eg. 20Hz at mid distance and 5Hz when far). Evaluated per-player. Use empty for a constant rate up to the cull distance.
+    API_FIELD() Array<ReplicationLOD> LODs;
+};
+
+/// <summary>
+/// Adaptive network replication settings container. Used to automatically reduce replication rate when server is overloaded or clients receive too much data.
+/// </summary>
+API_STRUCT() struct ARIZONAFRAMEWORK_API AdaptiveReplicationSettings : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(AdaptiveReplicationSettings);
+
+    // Enables automatic adjustment of the replication scale (globally and per-client).
+    API_FIELD() bool Enabled = false;
+    // The minimum replication scale (eg. 0.25 allows to slow down rep rate up to 4 times).
+    API_FIELD() float MinScale = 0.25f;
+    // The maximum replication scale.
+    API_FIELD() float MaxScale = 1.0f;
+    // The target server frame time (in milliseconds). Replication scale is reduced when frames take longer. Use 0 to use engine update FPS.
+    API_FIELD() float TargetFrameTime = 0.0f;
+    // The target amount of data sent to a single client (in bytes per second, estimated from replication settings). Client replication scale is reduced when exceeded. Use 0 if unused.
+    API_FIELD() int32 TargetBytesPerClient = 0;
+    // The maximum amount of objects waiting for the replication to a single client (over bandwidth budget). Client replication scale is reduced when exceeded. Use 0 if unused.
+    API_FIELD() int32 MaxQueueDepth = 0;
+    // The scale reduction factor applied on overload (eg. 0.1 reduces scale by 10% each network update).
+    API_FIELD() float DecreaseRate = 0.1f;
+    // The scale increase per second when there is no overload.
+    API_FIELD() float IncreaseRate = 0.2f;
 };
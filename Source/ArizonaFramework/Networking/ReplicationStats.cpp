@@ -0,0 +1,57 @@
+#include "ReplicationStats.h"
+
+void ReplicationStats::Clear(int32 clientsCount)
+{
+    Considered = 0;
+    Culled = 0;
+    Sent = 0;
+    Bytes = 0;
+    ClientBytes.Resize(clientsCount);
+    ClientBytes.SetAll(0);
+    ClientObjects.Resize(clientsCount);
+    ClientObjects.SetAll(0);
+    Types.Clear();
+    Cells.Clear();
+    TypesLookup.Clear();
+}
+
+ReplicationTypeStats& ReplicationStats::GetTypeStats(const ScriptingTypeHandle& type)
+{
+    int32 index;
+    if (!TypesLookup.TryGet(type, index))
+    {
+        index = Types.Count();
+        auto& stats = Types.AddOne();
+        stats.TypeName = type.GetType().Fullname;
+        stats.Considered = 0;
+        stats.Sent = 0;
+        stats.Bytes = 0;
+        TypesLookup.Add(type, index);
+    }
+    return Types[index];
+}
+
+void ReplicationStats::RecordConsidered(const ScriptingTypeHandle& type)
+{
+    Considered++;
+    GetTypeStats(type).Considered++;
+}
+
+void ReplicationStats::RecordSent(const ScriptingTypeHandle& type, int32 size, const NetworkClientsMask& clients, int32 clientsCount)
+{
+    int32 bytes = 0;
+    for (int32 i = 0; i < clientsCount && i < ClientBytes.Count(); i++)
+    {
+        if (clients.HasBit(i))
+        {
+            ClientBytes[i] += size;
+            ClientObjects[i]++;
+            bytes += size;
+        }
+    }
+    Sent++;
+    Bytes += bytes;
+    auto& typeStats = GetTypeStats(type);
+    typeStats.Sent++;
+    typeStats.Bytes += bytes;
+}
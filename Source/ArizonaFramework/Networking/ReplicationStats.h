@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Math/Int3.h"
+#include "Engine/Networking/NetworkReplicationHierarchy.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// Network replication statistics for a single object type.
+/// </summary>
+API_STRUCT(NoDefault) struct ARIZONAFRAMEWORK_API ReplicationTypeStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ReplicationTypeStats);
+
+    /// <summary>
+    /// The object type name.
+    /// </summary>
+    API_FIELD() StringAnsi TypeName;
+
+    /// <summary>
+    /// The amount of objects of this type considered for replication.
+    /// </summary>
+    API_FIELD() int32 Considered = 0;
+
+    /// <summary>
+    /// The amount of objects of this type sent to at least one client.
+    /// </summary>
+    API_FIELD() int32 Sent = 0;
+
+    /// <summary>
+    /// The estimated amount of bytes sent for objects of this type (from EstimatedSize in replication settings, summed over all clients).
+    /// </summary>
+    API_FIELD() int32 Bytes = 0;
+};
+
+/// <summary>
+/// Network replication statistics for a single grid cell.
+/// </summary>
+API_STRUCT(NoDefault) struct ARIZONAFRAMEWORK_API ReplicationCellStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ReplicationCellStats);
+
+    /// <summary>
+    /// The cell coordinates (in grid cells).
+    /// </summary>
+    API_FIELD() Int3 Coord = Int3::Zero;
+
+    /// <summary>
+    /// The interest group of the cell (0 if relevant to all clients).
+    /// </summary>
+    API_FIELD() uint32 Group = 0;
+
+    /// <summary>
+    /// The amount of objects in the cell.
+    /// </summary>
+    API_FIELD() int32 Objects = 0;
+
+    /// <summary>
+    /// The amount of objects sent from the cell.
+    /// </summary>
+    API_FIELD() int32 Sent = 0;
+
+    /// <summary>
+    /// True if cell was skipped (out of range or interest group of all clients).
+    /// </summary>
+    API_FIELD() bool Skipped = false;
+};
+
+/// <summary>
+/// Network replication hierarchy statistics from the last update. Gathered only when enabled (see ReplicationHierarchy.StatsEnabled). Counters cover all objects in the hierarchy, bytes are estimated from the replication settings (not measured from the sent messages).
+/// </summary>
+API_STRUCT(NoDefault) struct ARIZONAFRAMEWORK_API ReplicationStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ReplicationStats);
+
+    /// <summary>
+    /// The counter of the updates (incremented each time stats are gathered).
+    /// </summary>
+    API_FIELD() uint32 Frame = 0;
+
+    /// <summary>
+    /// The time spent in replication hierarchy update (in milliseconds).
+    /// </summary>
+    API_FIELD() float UpdateTime = 0.0f;
+
+    /// <summary>
+    /// The amount of objects considered for replication (due to update).
+    /// </summary>
+    API_FIELD() int32 Considered = 0;
+
+    /// <summary>
+    /// The amount of objects culled for all clients (distance, interest groups or levels of detail).
+    /// </summary>
+    API_FIELD() int32 Culled = 0;
+
+    /// <summary>
+    /// The amount of objects sent to at least one client.
+    /// </summary>
+    API_FIELD() int32 Sent = 0;
+
+    /// <summary>
+    /// The estimated amount of bytes sent (from EstimatedSize in replication settings, summed over all clients).
+    /// </summary>
+    API_FIELD() int32 Bytes = 0;
+
+    /// <summary>
+    /// The estimated amount of bytes sent to each client (from EstimatedSize in replication settings, indexed by the client index in NetworkManager.Clients).
+    /// </summary>
+    API_FIELD() Array<int32> ClientBytes;
+
+    /// <summary>
+    /// The amount of objects sent to each client (indexed by the client index in NetworkManager.Clients).
+    /// </summary>
+    API_FIELD() Array<int32> ClientObjects;
+
+    /// <summary>
+    /// The statistics per object type.
+    /// </summary>
+    API_FIELD() Array<ReplicationTypeStats> Types;
+
+    /// <summary>
+    /// The statistics per grid cell.
+    /// </summary>
+    API_FIELD() Array<ReplicationCellStats> Cells;
+
+    // Object type to index in Types (valid within a single update).
+    Dictionary<ScriptingTypeHandle, int32> TypesLookup;
+
+    // Clears the counters before the next update.
+    void Clear(int32 clientsCount);
+
+    // Gets the statistics of the object type (added if missing).
+    ReplicationTypeStats& GetTypeStats(const ScriptingTypeHandle& type);
+
+    // Records the object considered for replication.
+    void RecordConsidered(const ScriptingTypeHandle& type);
+
+    // Records the object sent to the clients (size is estimated from the replication settings).
+    void RecordSent(const ScriptingTypeHandle& type, int32 size, const NetworkClientsMask& clients, int32 clientsCount);
+};
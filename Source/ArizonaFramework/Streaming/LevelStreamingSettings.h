@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Engine/Core/Config/Settings.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/ISerializable.h"
+
+/// <summary>
+/// Streamed world cell (sub-level scene loaded when players are nearby).
+/// </summary>
+API_STRUCT(Namespace="ArizonaFramework.Streaming") struct ARIZONAFRAMEWORK_API LevelStreamingCell : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(LevelStreamingCell);
+
+    /// <summary>
+    /// The scene asset identifier.
+    /// </summary>
+    API_FIELD() Guid Scene;
+
+    /// <summary>
+    /// The world-space bounds of the cell contents. Used to calculate the distance to the players.
+    /// </summary>
+    API_FIELD() BoundingBox Bounds = BoundingBox::Empty;
+};
+
+/// <summary>
+/// The settings for level streaming (world made of multiple scenes loaded around players).
+/// </summary>
+API_CLASS(NoConstructor, Namespace="ArizonaFramework.Streaming") class ARIZONAFRAMEWORK_API LevelStreamingSettings : public SettingsBase
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(LevelStreamingSettings);
+    DECLARE_SETTINGS_GETTER(LevelStreamingSettings);
+public:
+    /// <summary>
+    /// The persistent scene asset identifier (never streamed). Player actors are anchored in it so they don't move between scenes when cells get loaded or unloaded. Required by level streaming (together with Use Players Root option in Game Instance settings) and cannot be one of the cells.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0), EditorDisplay(\"Streaming\")")
+    Guid PersistentScene;
+
+    /// <summary>
+    /// The streamed world cells. Level streaming is disabled if empty.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), EditorDisplay(\"Streaming\")")
+    Array<LevelStreamingCell> Cells;
+
+    /// <summary>
+    /// The distance from the player to the cell bounds at which the cell gets loaded.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), EditorDisplay(\"Streaming\"), Limit(0)")
+    float LoadDistance = 20000.0f;
+
+    /// <summary>
+    /// The distance from the player to the cell bounds at which the cell gets unloaded. Should be larger than LoadDistance to prevent loading and unloading the cell when player moves around its border.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), EditorDisplay(\"Streaming\"), Limit(0)")
+    float UnloadDistance = 25000.0f;
+
+    /// <summary>
+    /// The interval (in seconds) between the cells streaming updates.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), EditorDisplay(\"Streaming\"), Limit(0)")
+    float UpdateInterval = 0.5f;
+};
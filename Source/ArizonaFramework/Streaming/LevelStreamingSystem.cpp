@@ -0,0 +1,178 @@
+#include "LevelStreamingSystem.h"
+#include "LevelStreamingSettings.h"
+#include "ArizonaFramework/Core/GameInstance.h"
+#include "ArizonaFramework/Core/GameInstanceSettings.h"
+#include "ArizonaFramework/Core/GameState.h"
+#include "ArizonaFramework/Core/PlayerPawn.h"
+#include "ArizonaFramework/Core/PlayerState.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Config/GameSettings.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Networking/NetworkManager.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+IMPLEMENT_GAME_SETTINGS_GETTER(LevelStreamingSettings, "LevelStreaming");
+
+LevelStreamingSystem::LevelStreamingSystem(const SpawnParams& params)
+    : GameSystem(params)
+{
+    TickPhases = GameSystemTickPhases::Update;
+}
+
+LevelStreamingSystem* LevelStreamingSystem::GetInstance()
+{
+    return GameInstance::GetCachedGameSystem<LevelStreamingSystem>();
+}
+
+bool LevelStreamingSystem::IsCellLoaded(const Guid& sceneId) const
+{
+    int32 index;
+    return _cellsLookup.TryGet(sceneId, index) && _cells[index] == CellState::Loaded;
+}
+
+bool LevelStreamingSystem::CanBeUsed()
+{
+    const auto& settings = *LevelStreamingSettings::Get();
+    if (settings.Cells.IsEmpty())
+        return false;
+
+    // Player actors need to be anchored outside the streamed cells (otherwise they would be unloaded with the cell)
+    if (!GameInstanceSettings::Get()->UsePlayersRoot)
+    {
+        LOG(Error, "Level streaming requires Use Players Root option in Game Instance settings.");
+        return false;
+    }
+    if (!settings.PersistentScene.IsValid())
+    {
+        LOG(Error, "Level streaming requires Persistent Scene to be set.");
+        return false;
+    }
+    for (const LevelStreamingCell& cell : settings.Cells)
+    {
+        if (cell.Scene == settings.PersistentScene)
+        {
+            LOG(Error, "Level streaming Persistent Scene cannot be used as a cell.");
+            return false;
+        }
+    }
+    return true;
+}
+
+void LevelStreamingSystem::Initialize()
+{
+    const auto& settings = *LevelStreamingSettings::Get();
+    _cells.Resize(settings.Cells.Count());
+    _cellsLookup.Clear();
+    for (int32 i = 0; i < settings.Cells.Count(); i++)
+    {
+        // Cells could be already loaded (eg. as a startup scene)
+        _cells[i] = Level::FindScene(settings.Cells[i].Scene) ? CellState::Loaded : CellState::Unloaded;
+        _cellsLookup[settings.Cells[i].Scene] = i;
+    }
+    _timeLeft = 0.0f;
+    Level::SceneLoaded.Bind<LevelStreamingSystem, &LevelStreamingSystem::OnSceneLoaded>(this);
+    Level::SceneLoadError.Bind<LevelStreamingSystem, &LevelStreamingSystem::OnSceneLoadError>(this);
+    Level::SceneUnloaded.Bind<LevelStreamingSystem, &LevelStreamingSystem::OnSceneUnloaded>(this);
+}
+
+void LevelStreamingSystem::Deinitialize()
+{
+    Level::SceneLoaded.Unbind<LevelStreamingSystem, &LevelStreamingSystem::OnSceneLoaded>(this);
+    Level::SceneLoadError.Unbind<LevelStreamingSystem, &LevelStreamingSystem::OnSceneLoadError>(this);
+    Level::SceneUnloaded.Unbind<LevelStreamingSystem, &LevelStreamingSystem::OnSceneUnloaded>(this);
+    _cells.Clear();
+    _cellsLookup.Clear();
+}
+
+void LevelStreamingSystem::OnTick(GameSystemTickPhases phase)
+{
+    _timeLeft -= (float)Time::Update.UnscaledDeltaTime.GetTotalSeconds();
+    if (_timeLeft > 0.0f)
+        return;
+    const auto& settings = *LevelStreamingSettings::Get();
+    _timeLeft = settings.UpdateInterval;
+    UpdateStreaming();
+}
+
+void LevelStreamingSystem::UpdateStreaming()
+{
+    auto* instance = GetGameInstance();
+    const GameState* gameState = instance->GetGameState();
+    if (!gameState)
+        return;
+    PROFILE_CPU();
+    const auto& settings = *LevelStreamingSettings::Get();
+
+    // Anchor player actors in the persistent scene so streaming cells can be unloaded without moving players between scenes
+    Actor* playersRoot = instance->GetPlayersRoot();
+    if (playersRoot)
+    {
+        Scene* persistentScene = Level::FindScene(settings.PersistentScene);
+        if (persistentScene && playersRoot->GetParent() != persistentScene)
+            playersRoot->SetParent(persistentScene);
+    }
+
+    // Gather players locations (server streams around all players, client only around local ones)
+    _viewpoints.Clear();
+    const bool isClient = NetworkManager::IsClient();
+    for (const PlayerState* playerState : gameState->PlayerStates)
+    {
+        if (!playerState || !playerState->PlayerPawn || (isClient && playerState->NetworkClientId != NetworkManager::LocalClientId))
+            continue;
+        if (const Actor* pawnActor = playerState->PlayerPawn->GetActor())
+            _viewpoints.Add(pawnActor->GetPosition());
+    }
+
+    // Load cells in range and unload ones that are far from all players (distances hysteresis prevents streaming cells back and forth), without players all cells get unloaded
+    const float loadDistanceSq = settings.LoadDistance * settings.LoadDistance;
+    const float unloadDistance = Math::Max(settings.UnloadDistance, settings.LoadDistance);
+    const float unloadDistanceSq = unloadDistance * unloadDistance;
+    for (int32 i = 0; i < settings.Cells.Count() && i < _cells.Count(); i++)
+    {
+        const LevelStreamingCell& cell = settings.Cells[i];
+        Real minDistanceSq = MAX_Real;
+        for (const Vector3& viewpoint : _viewpoints)
+        {
+            const Vector3 closest = Vector3::Clamp(viewpoint, cell.Bounds.Minimum, cell.Bounds.Maximum);
+            minDistanceSq = Math::Min(minDistanceSq, Vector3::DistanceSquared(viewpoint, closest));
+        }
+        CellState& state = _cells[i];
+        if (state == CellState::Unloaded && minDistanceSq <= loadDistanceSq)
+        {
+            if (!Level::LoadSceneAsync(cell.Scene))
+                state = CellState::Loading;
+        }
+        else if (state == CellState::Loaded && minDistanceSq > unloadDistanceSq)
+        {
+            Scene* scene = Level::FindScene(cell.Scene);
+            if (scene && !Level::UnloadSceneAsync(scene))
+                state = CellState::Unloading;
+            else if (!scene)
+                state = CellState::Unloaded;
+        }
+    }
+}
+
+void LevelStreamingSystem::SetCellState(const Guid& sceneId, CellState state)
+{
+    int32 index;
+    if (_cellsLookup.TryGet(sceneId, index))
+        _cells[index] = state;
+}
+
+void LevelStreamingSystem::OnSceneLoaded(Scene* scene, const Guid& sceneId)
+{
+    SetCellState(sceneId, CellState::Loaded);
+}
+
+void LevelStreamingSystem::OnSceneLoadError(Scene* scene, const Guid& sceneId)
+{
+    SetCellState(sceneId, CellState::Unloaded);
+}
+
+void LevelStreamingSystem::OnSceneUnloaded(Scene* scene, const Guid& sceneId)
+{
+    SetCellState(sceneId, CellState::Unloaded);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "ArizonaFramework/Core/GameSystem.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Math/Vector3.h"
+
+class Scene;
+
+/// <summary>
+/// World streaming manager that loads and unloads scene cells (see LevelStreamingSettings) around the player pawns. Server loads cells around all players, clients only around their local players. Cells are loaded asynchronously.
+/// </summary>
+API_CLASS(Namespace="ArizonaFramework.Streaming") class ARIZONAFRAMEWORK_API LevelStreamingSystem : public GameSystem
+{
+    DECLARE_SCRIPTING_TYPE(LevelStreamingSystem);
+
+private:
+    enum class CellState : uint8
+    {
+        Unloaded,
+        Loading,
+        Loaded,
+        Unloading,
+    };
+
+    Array<CellState> _cells;
+    Dictionary<Guid, int32> _cellsLookup;
+    Array<Vector3> _viewpoints;
+    float _timeLeft = 0.0f;
+
+public:
+    /// <summary>
+    /// Gets the level streaming system instance.
+    /// </summary>
+    API_PROPERTY() static LevelStreamingSystem* GetInstance();
+
+    /// <summary>
+    /// Checks if the cell scene is loaded.
+    /// </summary>
+    /// <param name="sceneId">The cell scene asset identifier.</param>
+    /// <returns>True if cell is loaded, otherwise false.</returns>
+    API_FUNCTION() bool IsCellLoaded(const Guid& sceneId) const;
+
+private:
+    void UpdateStreaming();
+    void SetCellState(const Guid& sceneId, CellState state);
+    void OnSceneLoaded(Scene* scene, const Guid& sceneId);
+    void OnSceneLoadError(Scene* scene, const Guid& sceneId);
+    void OnSceneUnloaded(Scene* scene, const Guid& sceneId);
+
+public:
+    // [GameSystem]
+    bool CanBeUsed() override;
+    void Initialize() override;
+    void Deinitialize() override;
+    void OnTick(GameSystemTickPhases phase) override;
+};
@@ -66,9 +66,7 @@ void UISystem::OnInputContextChanged(InputContextType prev)
 
 UISystem* UISystem::GetInstance()
 {
-    if (auto* instance = GameInstance::GetInstance())
-        return instance->GetGameSystem<UISystem>();
-    return nullptr;
+    return GameInstance::GetCachedGameSystem<UISystem>();
 }
 
 void UISystem::Initialize()
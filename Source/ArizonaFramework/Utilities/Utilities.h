@@ -5,6 +5,7 @@
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/Script.h"
 #include "Engine/Level/Actor.h"
+#include "Engine/Networking/NetworkReplicator.h"
 
 /// <summary>
 /// Game utilities function library.
@@ -26,4 +27,23 @@ API_CLASS(Static) class ARIZONAFRAMEWORK_API Utilities
         }
         return nullptr;
     }
+
+    /// <summary>
+    /// Spawns the actor with all attached scripts over the network for the given clients. Child actors are spawned (with their scripts and children) only if they are explicitly registered for replication (eg. via NetworkReplicator.AddObject). Objects of a single hierarchy spawned within the same frame with the same target clients are sent within a single spawn message. Use hierarchical NetworkReplicator.SetObjectOwnership to pass ownership to the whole tree.
+    /// </summary>
+    /// <param name="actor">The root actor to spawn.</param>
+    /// <param name="clientIds">The target clients to spawn the objects for. Empty to spawn for all clients.</param>
+    API_FUNCTION() static void SpawnNetworkActorTree(Actor* actor, API_PARAM(DefaultValue=null) const DataContainer<uint32>& clientIds)
+    {
+        if (!actor)
+            return;
+        NetworkReplicator::SpawnObject(actor, clientIds);
+        for (auto* script : actor->Scripts)
+            NetworkReplicator::SpawnObject(script, clientIds);
+        for (auto* child : actor->Children)
+        {
+            if (NetworkReplicator::GetObjectRole(child) != NetworkObjectRole::None)
+                SpawnNetworkActorTree(child, clientIds);
+        }
+    }
 };